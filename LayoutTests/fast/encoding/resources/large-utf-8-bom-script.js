@@ -0,0 +1,423 @@
+﻿// A large script that starts with a byte order mark. The BOM overrides the charset attribute
+// of the script element that loads it.
+window.utf8ScriptText = "é中文";
+// Padding so that the script is large enough to be decoded on a helper thread: 0000
+// Padding so that the script is large enough to be decoded on a helper thread: 0001
+// Padding so that the script is large enough to be decoded on a helper thread: 0002
+// Padding so that the script is large enough to be decoded on a helper thread: 0003
+// Padding so that the script is large enough to be decoded on a helper thread: 0004
+// Padding so that the script is large enough to be decoded on a helper thread: 0005
+// Padding so that the script is large enough to be decoded on a helper thread: 0006
+// Padding so that the script is large enough to be decoded on a helper thread: 0007
+// Padding so that the script is large enough to be decoded on a helper thread: 0008
+// Padding so that the script is large enough to be decoded on a helper thread: 0009
+// Padding so that the script is large enough to be decoded on a helper thread: 0010
+// Padding so that the script is large enough to be decoded on a helper thread: 0011
+// Padding so that the script is large enough to be decoded on a helper thread: 0012
+// Padding so that the script is large enough to be decoded on a helper thread: 0013
+// Padding so that the script is large enough to be decoded on a helper thread: 0014
+// Padding so that the script is large enough to be decoded on a helper thread: 0015
+// Padding so that the script is large enough to be decoded on a helper thread: 0016
+// Padding so that the script is large enough to be decoded on a helper thread: 0017
+// Padding so that the script is large enough to be decoded on a helper thread: 0018
+// Padding so that the script is large enough to be decoded on a helper thread: 0019
+// Padding so that the script is large enough to be decoded on a helper thread: 0020
+// Padding so that the script is large enough to be decoded on a helper thread: 0021
+// Padding so that the script is large enough to be decoded on a helper thread: 0022
+// Padding so that the script is large enough to be decoded on a helper thread: 0023
+// Padding so that the script is large enough to be decoded on a helper thread: 0024
+// Padding so that the script is large enough to be decoded on a helper thread: 0025
+// Padding so that the script is large enough to be decoded on a helper thread: 0026
+// Padding so that the script is large enough to be decoded on a helper thread: 0027
+// Padding so that the script is large enough to be decoded on a helper thread: 0028
+// Padding so that the script is large enough to be decoded on a helper thread: 0029
+// Padding so that the script is large enough to be decoded on a helper thread: 0030
+// Padding so that the script is large enough to be decoded on a helper thread: 0031
+// Padding so that the script is large enough to be decoded on a helper thread: 0032
+// Padding so that the script is large enough to be decoded on a helper thread: 0033
+// Padding so that the script is large enough to be decoded on a helper thread: 0034
+// Padding so that the script is large enough to be decoded on a helper thread: 0035
+// Padding so that the script is large enough to be decoded on a helper thread: 0036
+// Padding so that the script is large enough to be decoded on a helper thread: 0037
+// Padding so that the script is large enough to be decoded on a helper thread: 0038
+// Padding so that the script is large enough to be decoded on a helper thread: 0039
+// Padding so that the script is large enough to be decoded on a helper thread: 0040
+// Padding so that the script is large enough to be decoded on a helper thread: 0041
+// Padding so that the script is large enough to be decoded on a helper thread: 0042
+// Padding so that the script is large enough to be decoded on a helper thread: 0043
+// Padding so that the script is large enough to be decoded on a helper thread: 0044
+// Padding so that the script is large enough to be decoded on a helper thread: 0045
+// Padding so that the script is large enough to be decoded on a helper thread: 0046
+// Padding so that the script is large enough to be decoded on a helper thread: 0047
+// Padding so that the script is large enough to be decoded on a helper thread: 0048
+// Padding so that the script is large enough to be decoded on a helper thread: 0049
+// Padding so that the script is large enough to be decoded on a helper thread: 0050
+// Padding so that the script is large enough to be decoded on a helper thread: 0051
+// Padding so that the script is large enough to be decoded on a helper thread: 0052
+// Padding so that the script is large enough to be decoded on a helper thread: 0053
+// Padding so that the script is large enough to be decoded on a helper thread: 0054
+// Padding so that the script is large enough to be decoded on a helper thread: 0055
+// Padding so that the script is large enough to be decoded on a helper thread: 0056
+// Padding so that the script is large enough to be decoded on a helper thread: 0057
+// Padding so that the script is large enough to be decoded on a helper thread: 0058
+// Padding so that the script is large enough to be decoded on a helper thread: 0059
+// Padding so that the script is large enough to be decoded on a helper thread: 0060
+// Padding so that the script is large enough to be decoded on a helper thread: 0061
+// Padding so that the script is large enough to be decoded on a helper thread: 0062
+// Padding so that the script is large enough to be decoded on a helper thread: 0063
+// Padding so that the script is large enough to be decoded on a helper thread: 0064
+// Padding so that the script is large enough to be decoded on a helper thread: 0065
+// Padding so that the script is large enough to be decoded on a helper thread: 0066
+// Padding so that the script is large enough to be decoded on a helper thread: 0067
+// Padding so that the script is large enough to be decoded on a helper thread: 0068
+// Padding so that the script is large enough to be decoded on a helper thread: 0069
+// Padding so that the script is large enough to be decoded on a helper thread: 0070
+// Padding so that the script is large enough to be decoded on a helper thread: 0071
+// Padding so that the script is large enough to be decoded on a helper thread: 0072
+// Padding so that the script is large enough to be decoded on a helper thread: 0073
+// Padding so that the script is large enough to be decoded on a helper thread: 0074
+// Padding so that the script is large enough to be decoded on a helper thread: 0075
+// Padding so that the script is large enough to be decoded on a helper thread: 0076
+// Padding so that the script is large enough to be decoded on a helper thread: 0077
+// Padding so that the script is large enough to be decoded on a helper thread: 0078
+// Padding so that the script is large enough to be decoded on a helper thread: 0079
+// Padding so that the script is large enough to be decoded on a helper thread: 0080
+// Padding so that the script is large enough to be decoded on a helper thread: 0081
+// Padding so that the script is large enough to be decoded on a helper thread: 0082
+// Padding so that the script is large enough to be decoded on a helper thread: 0083
+// Padding so that the script is large enough to be decoded on a helper thread: 0084
+// Padding so that the script is large enough to be decoded on a helper thread: 0085
+// Padding so that the script is large enough to be decoded on a helper thread: 0086
+// Padding so that the script is large enough to be decoded on a helper thread: 0087
+// Padding so that the script is large enough to be decoded on a helper thread: 0088
+// Padding so that the script is large enough to be decoded on a helper thread: 0089
+// Padding so that the script is large enough to be decoded on a helper thread: 0090
+// Padding so that the script is large enough to be decoded on a helper thread: 0091
+// Padding so that the script is large enough to be decoded on a helper thread: 0092
+// Padding so that the script is large enough to be decoded on a helper thread: 0093
+// Padding so that the script is large enough to be decoded on a helper thread: 0094
+// Padding so that the script is large enough to be decoded on a helper thread: 0095
+// Padding so that the script is large enough to be decoded on a helper thread: 0096
+// Padding so that the script is large enough to be decoded on a helper thread: 0097
+// Padding so that the script is large enough to be decoded on a helper thread: 0098
+// Padding so that the script is large enough to be decoded on a helper thread: 0099
+// Padding so that the script is large enough to be decoded on a helper thread: 0100
+// Padding so that the script is large enough to be decoded on a helper thread: 0101
+// Padding so that the script is large enough to be decoded on a helper thread: 0102
+// Padding so that the script is large enough to be decoded on a helper thread: 0103
+// Padding so that the script is large enough to be decoded on a helper thread: 0104
+// Padding so that the script is large enough to be decoded on a helper thread: 0105
+// Padding so that the script is large enough to be decoded on a helper thread: 0106
+// Padding so that the script is large enough to be decoded on a helper thread: 0107
+// Padding so that the script is large enough to be decoded on a helper thread: 0108
+// Padding so that the script is large enough to be decoded on a helper thread: 0109
+// Padding so that the script is large enough to be decoded on a helper thread: 0110
+// Padding so that the script is large enough to be decoded on a helper thread: 0111
+// Padding so that the script is large enough to be decoded on a helper thread: 0112
+// Padding so that the script is large enough to be decoded on a helper thread: 0113
+// Padding so that the script is large enough to be decoded on a helper thread: 0114
+// Padding so that the script is large enough to be decoded on a helper thread: 0115
+// Padding so that the script is large enough to be decoded on a helper thread: 0116
+// Padding so that the script is large enough to be decoded on a helper thread: 0117
+// Padding so that the script is large enough to be decoded on a helper thread: 0118
+// Padding so that the script is large enough to be decoded on a helper thread: 0119
+// Padding so that the script is large enough to be decoded on a helper thread: 0120
+// Padding so that the script is large enough to be decoded on a helper thread: 0121
+// Padding so that the script is large enough to be decoded on a helper thread: 0122
+// Padding so that the script is large enough to be decoded on a helper thread: 0123
+// Padding so that the script is large enough to be decoded on a helper thread: 0124
+// Padding so that the script is large enough to be decoded on a helper thread: 0125
+// Padding so that the script is large enough to be decoded on a helper thread: 0126
+// Padding so that the script is large enough to be decoded on a helper thread: 0127
+// Padding so that the script is large enough to be decoded on a helper thread: 0128
+// Padding so that the script is large enough to be decoded on a helper thread: 0129
+// Padding so that the script is large enough to be decoded on a helper thread: 0130
+// Padding so that the script is large enough to be decoded on a helper thread: 0131
+// Padding so that the script is large enough to be decoded on a helper thread: 0132
+// Padding so that the script is large enough to be decoded on a helper thread: 0133
+// Padding so that the script is large enough to be decoded on a helper thread: 0134
+// Padding so that the script is large enough to be decoded on a helper thread: 0135
+// Padding so that the script is large enough to be decoded on a helper thread: 0136
+// Padding so that the script is large enough to be decoded on a helper thread: 0137
+// Padding so that the script is large enough to be decoded on a helper thread: 0138
+// Padding so that the script is large enough to be decoded on a helper thread: 0139
+// Padding so that the script is large enough to be decoded on a helper thread: 0140
+// Padding so that the script is large enough to be decoded on a helper thread: 0141
+// Padding so that the script is large enough to be decoded on a helper thread: 0142
+// Padding so that the script is large enough to be decoded on a helper thread: 0143
+// Padding so that the script is large enough to be decoded on a helper thread: 0144
+// Padding so that the script is large enough to be decoded on a helper thread: 0145
+// Padding so that the script is large enough to be decoded on a helper thread: 0146
+// Padding so that the script is large enough to be decoded on a helper thread: 0147
+// Padding so that the script is large enough to be decoded on a helper thread: 0148
+// Padding so that the script is large enough to be decoded on a helper thread: 0149
+// Padding so that the script is large enough to be decoded on a helper thread: 0150
+// Padding so that the script is large enough to be decoded on a helper thread: 0151
+// Padding so that the script is large enough to be decoded on a helper thread: 0152
+// Padding so that the script is large enough to be decoded on a helper thread: 0153
+// Padding so that the script is large enough to be decoded on a helper thread: 0154
+// Padding so that the script is large enough to be decoded on a helper thread: 0155
+// Padding so that the script is large enough to be decoded on a helper thread: 0156
+// Padding so that the script is large enough to be decoded on a helper thread: 0157
+// Padding so that the script is large enough to be decoded on a helper thread: 0158
+// Padding so that the script is large enough to be decoded on a helper thread: 0159
+// Padding so that the script is large enough to be decoded on a helper thread: 0160
+// Padding so that the script is large enough to be decoded on a helper thread: 0161
+// Padding so that the script is large enough to be decoded on a helper thread: 0162
+// Padding so that the script is large enough to be decoded on a helper thread: 0163
+// Padding so that the script is large enough to be decoded on a helper thread: 0164
+// Padding so that the script is large enough to be decoded on a helper thread: 0165
+// Padding so that the script is large enough to be decoded on a helper thread: 0166
+// Padding so that the script is large enough to be decoded on a helper thread: 0167
+// Padding so that the script is large enough to be decoded on a helper thread: 0168
+// Padding so that the script is large enough to be decoded on a helper thread: 0169
+// Padding so that the script is large enough to be decoded on a helper thread: 0170
+// Padding so that the script is large enough to be decoded on a helper thread: 0171
+// Padding so that the script is large enough to be decoded on a helper thread: 0172
+// Padding so that the script is large enough to be decoded on a helper thread: 0173
+// Padding so that the script is large enough to be decoded on a helper thread: 0174
+// Padding so that the script is large enough to be decoded on a helper thread: 0175
+// Padding so that the script is large enough to be decoded on a helper thread: 0176
+// Padding so that the script is large enough to be decoded on a helper thread: 0177
+// Padding so that the script is large enough to be decoded on a helper thread: 0178
+// Padding so that the script is large enough to be decoded on a helper thread: 0179
+// Padding so that the script is large enough to be decoded on a helper thread: 0180
+// Padding so that the script is large enough to be decoded on a helper thread: 0181
+// Padding so that the script is large enough to be decoded on a helper thread: 0182
+// Padding so that the script is large enough to be decoded on a helper thread: 0183
+// Padding so that the script is large enough to be decoded on a helper thread: 0184
+// Padding so that the script is large enough to be decoded on a helper thread: 0185
+// Padding so that the script is large enough to be decoded on a helper thread: 0186
+// Padding so that the script is large enough to be decoded on a helper thread: 0187
+// Padding so that the script is large enough to be decoded on a helper thread: 0188
+// Padding so that the script is large enough to be decoded on a helper thread: 0189
+// Padding so that the script is large enough to be decoded on a helper thread: 0190
+// Padding so that the script is large enough to be decoded on a helper thread: 0191
+// Padding so that the script is large enough to be decoded on a helper thread: 0192
+// Padding so that the script is large enough to be decoded on a helper thread: 0193
+// Padding so that the script is large enough to be decoded on a helper thread: 0194
+// Padding so that the script is large enough to be decoded on a helper thread: 0195
+// Padding so that the script is large enough to be decoded on a helper thread: 0196
+// Padding so that the script is large enough to be decoded on a helper thread: 0197
+// Padding so that the script is large enough to be decoded on a helper thread: 0198
+// Padding so that the script is large enough to be decoded on a helper thread: 0199
+// Padding so that the script is large enough to be decoded on a helper thread: 0200
+// Padding so that the script is large enough to be decoded on a helper thread: 0201
+// Padding so that the script is large enough to be decoded on a helper thread: 0202
+// Padding so that the script is large enough to be decoded on a helper thread: 0203
+// Padding so that the script is large enough to be decoded on a helper thread: 0204
+// Padding so that the script is large enough to be decoded on a helper thread: 0205
+// Padding so that the script is large enough to be decoded on a helper thread: 0206
+// Padding so that the script is large enough to be decoded on a helper thread: 0207
+// Padding so that the script is large enough to be decoded on a helper thread: 0208
+// Padding so that the script is large enough to be decoded on a helper thread: 0209
+// Padding so that the script is large enough to be decoded on a helper thread: 0210
+// Padding so that the script is large enough to be decoded on a helper thread: 0211
+// Padding so that the script is large enough to be decoded on a helper thread: 0212
+// Padding so that the script is large enough to be decoded on a helper thread: 0213
+// Padding so that the script is large enough to be decoded on a helper thread: 0214
+// Padding so that the script is large enough to be decoded on a helper thread: 0215
+// Padding so that the script is large enough to be decoded on a helper thread: 0216
+// Padding so that the script is large enough to be decoded on a helper thread: 0217
+// Padding so that the script is large enough to be decoded on a helper thread: 0218
+// Padding so that the script is large enough to be decoded on a helper thread: 0219
+// Padding so that the script is large enough to be decoded on a helper thread: 0220
+// Padding so that the script is large enough to be decoded on a helper thread: 0221
+// Padding so that the script is large enough to be decoded on a helper thread: 0222
+// Padding so that the script is large enough to be decoded on a helper thread: 0223
+// Padding so that the script is large enough to be decoded on a helper thread: 0224
+// Padding so that the script is large enough to be decoded on a helper thread: 0225
+// Padding so that the script is large enough to be decoded on a helper thread: 0226
+// Padding so that the script is large enough to be decoded on a helper thread: 0227
+// Padding so that the script is large enough to be decoded on a helper thread: 0228
+// Padding so that the script is large enough to be decoded on a helper thread: 0229
+// Padding so that the script is large enough to be decoded on a helper thread: 0230
+// Padding so that the script is large enough to be decoded on a helper thread: 0231
+// Padding so that the script is large enough to be decoded on a helper thread: 0232
+// Padding so that the script is large enough to be decoded on a helper thread: 0233
+// Padding so that the script is large enough to be decoded on a helper thread: 0234
+// Padding so that the script is large enough to be decoded on a helper thread: 0235
+// Padding so that the script is large enough to be decoded on a helper thread: 0236
+// Padding so that the script is large enough to be decoded on a helper thread: 0237
+// Padding so that the script is large enough to be decoded on a helper thread: 0238
+// Padding so that the script is large enough to be decoded on a helper thread: 0239
+// Padding so that the script is large enough to be decoded on a helper thread: 0240
+// Padding so that the script is large enough to be decoded on a helper thread: 0241
+// Padding so that the script is large enough to be decoded on a helper thread: 0242
+// Padding so that the script is large enough to be decoded on a helper thread: 0243
+// Padding so that the script is large enough to be decoded on a helper thread: 0244
+// Padding so that the script is large enough to be decoded on a helper thread: 0245
+// Padding so that the script is large enough to be decoded on a helper thread: 0246
+// Padding so that the script is large enough to be decoded on a helper thread: 0247
+// Padding so that the script is large enough to be decoded on a helper thread: 0248
+// Padding so that the script is large enough to be decoded on a helper thread: 0249
+// Padding so that the script is large enough to be decoded on a helper thread: 0250
+// Padding so that the script is large enough to be decoded on a helper thread: 0251
+// Padding so that the script is large enough to be decoded on a helper thread: 0252
+// Padding so that the script is large enough to be decoded on a helper thread: 0253
+// Padding so that the script is large enough to be decoded on a helper thread: 0254
+// Padding so that the script is large enough to be decoded on a helper thread: 0255
+// Padding so that the script is large enough to be decoded on a helper thread: 0256
+// Padding so that the script is large enough to be decoded on a helper thread: 0257
+// Padding so that the script is large enough to be decoded on a helper thread: 0258
+// Padding so that the script is large enough to be decoded on a helper thread: 0259
+// Padding so that the script is large enough to be decoded on a helper thread: 0260
+// Padding so that the script is large enough to be decoded on a helper thread: 0261
+// Padding so that the script is large enough to be decoded on a helper thread: 0262
+// Padding so that the script is large enough to be decoded on a helper thread: 0263
+// Padding so that the script is large enough to be decoded on a helper thread: 0264
+// Padding so that the script is large enough to be decoded on a helper thread: 0265
+// Padding so that the script is large enough to be decoded on a helper thread: 0266
+// Padding so that the script is large enough to be decoded on a helper thread: 0267
+// Padding so that the script is large enough to be decoded on a helper thread: 0268
+// Padding so that the script is large enough to be decoded on a helper thread: 0269
+// Padding so that the script is large enough to be decoded on a helper thread: 0270
+// Padding so that the script is large enough to be decoded on a helper thread: 0271
+// Padding so that the script is large enough to be decoded on a helper thread: 0272
+// Padding so that the script is large enough to be decoded on a helper thread: 0273
+// Padding so that the script is large enough to be decoded on a helper thread: 0274
+// Padding so that the script is large enough to be decoded on a helper thread: 0275
+// Padding so that the script is large enough to be decoded on a helper thread: 0276
+// Padding so that the script is large enough to be decoded on a helper thread: 0277
+// Padding so that the script is large enough to be decoded on a helper thread: 0278
+// Padding so that the script is large enough to be decoded on a helper thread: 0279
+// Padding so that the script is large enough to be decoded on a helper thread: 0280
+// Padding so that the script is large enough to be decoded on a helper thread: 0281
+// Padding so that the script is large enough to be decoded on a helper thread: 0282
+// Padding so that the script is large enough to be decoded on a helper thread: 0283
+// Padding so that the script is large enough to be decoded on a helper thread: 0284
+// Padding so that the script is large enough to be decoded on a helper thread: 0285
+// Padding so that the script is large enough to be decoded on a helper thread: 0286
+// Padding so that the script is large enough to be decoded on a helper thread: 0287
+// Padding so that the script is large enough to be decoded on a helper thread: 0288
+// Padding so that the script is large enough to be decoded on a helper thread: 0289
+// Padding so that the script is large enough to be decoded on a helper thread: 0290
+// Padding so that the script is large enough to be decoded on a helper thread: 0291
+// Padding so that the script is large enough to be decoded on a helper thread: 0292
+// Padding so that the script is large enough to be decoded on a helper thread: 0293
+// Padding so that the script is large enough to be decoded on a helper thread: 0294
+// Padding so that the script is large enough to be decoded on a helper thread: 0295
+// Padding so that the script is large enough to be decoded on a helper thread: 0296
+// Padding so that the script is large enough to be decoded on a helper thread: 0297
+// Padding so that the script is large enough to be decoded on a helper thread: 0298
+// Padding so that the script is large enough to be decoded on a helper thread: 0299
+// Padding so that the script is large enough to be decoded on a helper thread: 0300
+// Padding so that the script is large enough to be decoded on a helper thread: 0301
+// Padding so that the script is large enough to be decoded on a helper thread: 0302
+// Padding so that the script is large enough to be decoded on a helper thread: 0303
+// Padding so that the script is large enough to be decoded on a helper thread: 0304
+// Padding so that the script is large enough to be decoded on a helper thread: 0305
+// Padding so that the script is large enough to be decoded on a helper thread: 0306
+// Padding so that the script is large enough to be decoded on a helper thread: 0307
+// Padding so that the script is large enough to be decoded on a helper thread: 0308
+// Padding so that the script is large enough to be decoded on a helper thread: 0309
+// Padding so that the script is large enough to be decoded on a helper thread: 0310
+// Padding so that the script is large enough to be decoded on a helper thread: 0311
+// Padding so that the script is large enough to be decoded on a helper thread: 0312
+// Padding so that the script is large enough to be decoded on a helper thread: 0313
+// Padding so that the script is large enough to be decoded on a helper thread: 0314
+// Padding so that the script is large enough to be decoded on a helper thread: 0315
+// Padding so that the script is large enough to be decoded on a helper thread: 0316
+// Padding so that the script is large enough to be decoded on a helper thread: 0317
+// Padding so that the script is large enough to be decoded on a helper thread: 0318
+// Padding so that the script is large enough to be decoded on a helper thread: 0319
+// Padding so that the script is large enough to be decoded on a helper thread: 0320
+// Padding so that the script is large enough to be decoded on a helper thread: 0321
+// Padding so that the script is large enough to be decoded on a helper thread: 0322
+// Padding so that the script is large enough to be decoded on a helper thread: 0323
+// Padding so that the script is large enough to be decoded on a helper thread: 0324
+// Padding so that the script is large enough to be decoded on a helper thread: 0325
+// Padding so that the script is large enough to be decoded on a helper thread: 0326
+// Padding so that the script is large enough to be decoded on a helper thread: 0327
+// Padding so that the script is large enough to be decoded on a helper thread: 0328
+// Padding so that the script is large enough to be decoded on a helper thread: 0329
+// Padding so that the script is large enough to be decoded on a helper thread: 0330
+// Padding so that the script is large enough to be decoded on a helper thread: 0331
+// Padding so that the script is large enough to be decoded on a helper thread: 0332
+// Padding so that the script is large enough to be decoded on a helper thread: 0333
+// Padding so that the script is large enough to be decoded on a helper thread: 0334
+// Padding so that the script is large enough to be decoded on a helper thread: 0335
+// Padding so that the script is large enough to be decoded on a helper thread: 0336
+// Padding so that the script is large enough to be decoded on a helper thread: 0337
+// Padding so that the script is large enough to be decoded on a helper thread: 0338
+// Padding so that the script is large enough to be decoded on a helper thread: 0339
+// Padding so that the script is large enough to be decoded on a helper thread: 0340
+// Padding so that the script is large enough to be decoded on a helper thread: 0341
+// Padding so that the script is large enough to be decoded on a helper thread: 0342
+// Padding so that the script is large enough to be decoded on a helper thread: 0343
+// Padding so that the script is large enough to be decoded on a helper thread: 0344
+// Padding so that the script is large enough to be decoded on a helper thread: 0345
+// Padding so that the script is large enough to be decoded on a helper thread: 0346
+// Padding so that the script is large enough to be decoded on a helper thread: 0347
+// Padding so that the script is large enough to be decoded on a helper thread: 0348
+// Padding so that the script is large enough to be decoded on a helper thread: 0349
+// Padding so that the script is large enough to be decoded on a helper thread: 0350
+// Padding so that the script is large enough to be decoded on a helper thread: 0351
+// Padding so that the script is large enough to be decoded on a helper thread: 0352
+// Padding so that the script is large enough to be decoded on a helper thread: 0353
+// Padding so that the script is large enough to be decoded on a helper thread: 0354
+// Padding so that the script is large enough to be decoded on a helper thread: 0355
+// Padding so that the script is large enough to be decoded on a helper thread: 0356
+// Padding so that the script is large enough to be decoded on a helper thread: 0357
+// Padding so that the script is large enough to be decoded on a helper thread: 0358
+// Padding so that the script is large enough to be decoded on a helper thread: 0359
+// Padding so that the script is large enough to be decoded on a helper thread: 0360
+// Padding so that the script is large enough to be decoded on a helper thread: 0361
+// Padding so that the script is large enough to be decoded on a helper thread: 0362
+// Padding so that the script is large enough to be decoded on a helper thread: 0363
+// Padding so that the script is large enough to be decoded on a helper thread: 0364
+// Padding so that the script is large enough to be decoded on a helper thread: 0365
+// Padding so that the script is large enough to be decoded on a helper thread: 0366
+// Padding so that the script is large enough to be decoded on a helper thread: 0367
+// Padding so that the script is large enough to be decoded on a helper thread: 0368
+// Padding so that the script is large enough to be decoded on a helper thread: 0369
+// Padding so that the script is large enough to be decoded on a helper thread: 0370
+// Padding so that the script is large enough to be decoded on a helper thread: 0371
+// Padding so that the script is large enough to be decoded on a helper thread: 0372
+// Padding so that the script is large enough to be decoded on a helper thread: 0373
+// Padding so that the script is large enough to be decoded on a helper thread: 0374
+// Padding so that the script is large enough to be decoded on a helper thread: 0375
+// Padding so that the script is large enough to be decoded on a helper thread: 0376
+// Padding so that the script is large enough to be decoded on a helper thread: 0377
+// Padding so that the script is large enough to be decoded on a helper thread: 0378
+// Padding so that the script is large enough to be decoded on a helper thread: 0379
+// Padding so that the script is large enough to be decoded on a helper thread: 0380
+// Padding so that the script is large enough to be decoded on a helper thread: 0381
+// Padding so that the script is large enough to be decoded on a helper thread: 0382
+// Padding so that the script is large enough to be decoded on a helper thread: 0383
+// Padding so that the script is large enough to be decoded on a helper thread: 0384
+// Padding so that the script is large enough to be decoded on a helper thread: 0385
+// Padding so that the script is large enough to be decoded on a helper thread: 0386
+// Padding so that the script is large enough to be decoded on a helper thread: 0387
+// Padding so that the script is large enough to be decoded on a helper thread: 0388
+// Padding so that the script is large enough to be decoded on a helper thread: 0389
+// Padding so that the script is large enough to be decoded on a helper thread: 0390
+// Padding so that the script is large enough to be decoded on a helper thread: 0391
+// Padding so that the script is large enough to be decoded on a helper thread: 0392
+// Padding so that the script is large enough to be decoded on a helper thread: 0393
+// Padding so that the script is large enough to be decoded on a helper thread: 0394
+// Padding so that the script is large enough to be decoded on a helper thread: 0395
+// Padding so that the script is large enough to be decoded on a helper thread: 0396
+// Padding so that the script is large enough to be decoded on a helper thread: 0397
+// Padding so that the script is large enough to be decoded on a helper thread: 0398
+// Padding so that the script is large enough to be decoded on a helper thread: 0399
+// Padding so that the script is large enough to be decoded on a helper thread: 0400
+// Padding so that the script is large enough to be decoded on a helper thread: 0401
+// Padding so that the script is large enough to be decoded on a helper thread: 0402
+// Padding so that the script is large enough to be decoded on a helper thread: 0403
+// Padding so that the script is large enough to be decoded on a helper thread: 0404
+// Padding so that the script is large enough to be decoded on a helper thread: 0405
+// Padding so that the script is large enough to be decoded on a helper thread: 0406
+// Padding so that the script is large enough to be decoded on a helper thread: 0407
+// Padding so that the script is large enough to be decoded on a helper thread: 0408
+// Padding so that the script is large enough to be decoded on a helper thread: 0409
+// Padding so that the script is large enough to be decoded on a helper thread: 0410
+// Padding so that the script is large enough to be decoded on a helper thread: 0411
+// Padding so that the script is large enough to be decoded on a helper thread: 0412
+// Padding so that the script is large enough to be decoded on a helper thread: 0413
+// Padding so that the script is large enough to be decoded on a helper thread: 0414
+// Padding so that the script is large enough to be decoded on a helper thread: 0415
+// Padding so that the script is large enough to be decoded on a helper thread: 0416
+// Padding so that the script is large enough to be decoded on a helper thread: 0417
+// Padding so that the script is large enough to be decoded on a helper thread: 0418
+// Padding so that the script is large enough to be decoded on a helper thread: 0419
@@ -0,0 +1,102 @@
+description(
+"Tests number to string conversion and string to number parsing against fixed vectors, including halfway cases, subnormals, 17 digit results and the inputs the fast conversion paths hand to the bignum code."
+);
+
+// Scaling by two is exact, so this builds significand * 2^exponent without parsing a decimal string.
+function makeDouble(significand, exponent)
+{
+    var result = significand;
+    for (; exponent > 0; --exponent)
+        result *= 2;
+    for (; exponent < 0; ++exponent)
+        result /= 2;
+    return result;
+}
+
+debug("Exact integers and short fractions");
+shouldBeEqualToString("String(makeDouble(1, 0))", "1");
+shouldBeEqualToString("String(makeDouble(3602879701896397, -55))", "0.1");
+shouldBeEqualToString("String(makeDouble(1, -1))", "0.5");
+shouldBeEqualToString("String(makeDouble(25, 2))", "100");
+shouldBeEqualToString("String(makeDouble(8687443681197687, -46))", "123.456");
+shouldBeEqualToString("String(makeDouble(6004799503160661, -54))", "0.3333333333333333");
+debug("");
+debug("Formatting boundaries");
+shouldBeEqualToString("String(makeDouble(476837158203125, 21))", "1e+21");
+shouldBeEqualToString("String(makeDouble(7629394531249999, 17))", "999999999999999900000");
+shouldBeEqualToString("String(makeDouble(4722366482869645, -72))", "0.000001");
+shouldBeEqualToString("String(makeDouble(944473296573929, -73))", "1e-7");
+shouldBeEqualToString("String(makeDouble(2833419889721787, -74))", "1.5e-7");
+shouldBeEqualToString("String(makeDouble(3193262567998919, -111))", "1.23e-18");
+debug("");
+debug("The 17 digit maximum");
+shouldBeEqualToString("String(makeDouble(1351079888211149, -52))", "0.30000000000000004");
+shouldBeEqualToString("String(makeDouble(9007199254740991, 971))", "1.7976931348623157e+308");
+shouldBeEqualToString("String(makeDouble(1, -1022))", "2.2250738585072014e-308");
+shouldBeEqualToString("String(makeDouble(9007199254740991, 0))", "9007199254740991");
+shouldBeEqualToString("String(makeDouble(5629499534213121, -50))", "5.000000000000001");
+shouldBeEqualToString("String(makeDouble(2702159776422299, -53))", "0.30000000000000016");
+debug("");
+debug("Subnormals");
+shouldBeEqualToString("String(makeDouble(1, -1074))", "5e-324");
+shouldBeEqualToString("String(makeDouble(1, -1073))", "1e-323");
+shouldBeEqualToString("String(makeDouble(4503599627370495, -1074))", "2.225073858507201e-308");
+shouldBeEqualToString("String(makeDouble(625, -1070))", "4.9407e-320");
+shouldBeEqualToString("String(makeDouble(24987932279685, -1074))", "1.23456789e-310");
+debug("");
+debug("Grisu3 gives up on these and the bignum algorithm is used");
+shouldBeEqualToString("String(makeDouble(1927165405548295, -38))", "7010.986903145003");
+shouldBeEqualToString("String(makeDouble(2765749466282111, -2))", "691437366570527.8");
+shouldBeEqualToString("String(makeDouble(2386658662674131, 5))", "76373077205572200");
+shouldBeEqualToString("String(makeDouble(6106445945317087, 2))", "24425783781268348");
+shouldBeEqualToString("String(makeDouble(7492043578974725, -124))", "3.5227419612796727e-22");
+shouldBeEqualToString("String(makeDouble(7002272571709135, -1023))", "7.790286824725995e-293");
+shouldBeEqualToString("String(makeDouble(3139594320937693, 831))", "4.4957270050162115e+265");
+shouldBeEqualToString("String(makeDouble(1512710899722991, -1071))", "5.979027901141861e-308");
+debug("");
+debug("Halfway cases round to even");
+shouldBe("Number('9007199254740993')", "makeDouble(1, 53)");
+shouldBe("Number('9007199254740995')", "makeDouble(2251799813685249, 2)");
+shouldBe("Number('9007199254740993.0000000001')", "makeDouble(4503599627370497, 1)");
+shouldBe("Number('1.00000000000000011102230246251565404236316680908203125')", "makeDouble(1, 0)");
+shouldBe("Number('1.00000000000000011102230246251565404236316680908203126')", "makeDouble(4503599627370497, -52)");
+shouldBe("Number('1.00000000000000033306690738754696212708950042724609375')", "makeDouble(2251799813685249, -51)");
+shouldBe("Number('0.500000000000000027755575615628913510590791702270507812500')", "makeDouble(1, -1)");
+debug("");
+debug("More than 19 significant digits");
+shouldBe("Number('0.1000000000000000055511151231257827021181583404541015625')", "makeDouble(3602879701896397, -55)");
+shouldBe("Number('123456789012345678901234567890')", "makeDouble(3508852984519583, 45)");
+shouldBe("Number('3.14159265358979323846264338327950288')", "makeDouble(884279719003555, -48)");
+shouldBe("Number('2.22507385850720113605740979670913197593481954635164564e-308')", "makeDouble(4503599627370495, -1074)");
+debug("");
+debug("Subnormal results");
+shouldBe("Number('4.9406564584124654e-324')", "makeDouble(1, -1074)");
+shouldBe("Number('2.4703282292062328e-324')", "makeDouble(1, -1074)");
+shouldBe("Number('2.4703282292062327e-324')", "0");
+shouldBe("Number('2.2250738585072011e-308')", "makeDouble(4503599627370495, -1074)");
+shouldBe("Number('2.2250738585072012e-308')", "makeDouble(1, -1022)");
+shouldBe("Number('1e-310')", "makeDouble(20240225330731, -1074)");
+shouldBe("Number('4.9e-324')", "makeDouble(1, -1074)");
+debug("");
+debug("Exponents outside the table");
+shouldBe("Number('1e-400')", "0");
+shouldBe("Number('1e309')", "Infinity");
+shouldBe("Number('1.7976931348623157e308')", "makeDouble(9007199254740991, 971)");
+shouldBe("Number('1.7976931348623158e308')", "makeDouble(9007199254740991, 971)");
+shouldBe("Number('1.7976931348623159e308')", "Infinity");
+shouldBe("Number('0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001e300')", "makeDouble(6427752177035961, -202)");
+debug("");
+debug("Short inputs");
+shouldBe("Number('0.1')", "makeDouble(3602879701896397, -55)");
+shouldBe("Number('0.3')", "makeDouble(5404319552844595, -54)");
+shouldBe("Number('1e23')", "makeDouble(2980232238769531, 25)");
+shouldBe("Number('8.41e21')", "makeDouble(4010200500488281, 21)");
+shouldBe("Number('5e-324')", "makeDouble(1, -1074)");
+shouldBe("Number('179769313486231570000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000')", "makeDouble(9007199254740991, 971)");
+debug("");
+debug("Round trips");
+var roundTripValues = [makeDouble(1, -1074), makeDouble(4503599627370495, -1074), makeDouble(4503599627370496, -1074), makeDouble(9007199254740991, 971), makeDouble(6004799503160661, -54), makeDouble(7314547828125349, -40)];
+for (var i = 0; i < roundTripValues.length; ++i)
+    shouldBe("Number(String(roundTripValues[" + i + "]))", "roundTripValues[" + i + "]");
+
+var successfullyParsed = true;
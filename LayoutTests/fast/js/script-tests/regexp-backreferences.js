@@ -0,0 +1,42 @@
+description(
+"Tests back-references, including the shapes the regular expression JIT compiles and those it leaves to the interpreter."
+);
+
+debug("References to an earlier group");
+shouldBe("/(a)\\1/.exec('xaa')", "['aa', 'a']");
+shouldBe("/(a|b)\\1/.exec('abba')", "['bb', 'b']");
+shouldBe("/(ab)c\\1/.exec('abcabcab')", "['abcab', 'ab']");
+shouldBeNull("/(ab)c\\1/.exec('abcaxc')");
+shouldBe("/<(\\w+)>[^<]*<\\/\\1>/.exec('<b>x</i><i>y</i>')", "['<i>y</i>', 'i']");
+shouldBe("/(a)?b\\1/.exec('b')", "['b', undefined]");
+shouldBe("/(a*)b\\1c/.exec('aabaac')", "['aabaac', 'aa']");
+shouldBe("/(a*)b\\1c/.exec('aabac')", "['abac', 'a']");
+debug("");
+
+debug("References inside the group they refer to match the empty string");
+shouldBe("/((\\1(.)?)|})c/.exec('cxx')", "['c', '', '', undefined]");
+shouldBe("/((\\1.?)|})c/.exec('cxx')", "['c', '', '']");
+shouldBe("/(\\1(.)?|})c/.exec('cxx')", "['c', '', undefined]");
+shouldBe("/(a\\1)+/.exec('aa')", "['aa', 'a']");
+debug("");
+
+debug("References before the group they refer to match the empty string");
+shouldBe("/\\1(a)/.exec('a')", "['a', 'a']");
+shouldBe("/\\2(a)(b)/.exec('ab')", "['ab', 'a', 'b']");
+debug("");
+
+debug("References to groups that are repeated or in assertions");
+shouldBe("/(?:(a)b)+\\1/.exec('ababa')", "['ababa', 'a']");
+shouldBe("/(?=(a))\\1b/.exec('ab')", "['ab', 'a']");
+shouldBe("/(a)\\1/i.exec('aA')", "['aA', 'a']");
+debug("");
+
+debug("Patterns the JIT compiles and then hands to the interpreter");
+shouldBeNull("/(())c(((?!\\s1|\\2)a{1})(){0})/.exec('aacax b b')");
+shouldBe("/(?!aa(?=())|b)(?:c){2}\\1/.exec('cc')", "['cc', undefined]");
+shouldBe("/(?=(a))(?:\\1b){2}/.exec('xababx')", "['abab', 'a']");
+shouldBe("/(?:(x)|y){2}(?:\\1z){2}/.exec('yxxzxz')", "['yxxzxz', 'x']");
+shouldBe("/(?!\\s1)\\s(a)\\1/.exec(' 1 aa')", "[' aa', 'a']");
+debug("");
+
+var successfullyParsed = true;
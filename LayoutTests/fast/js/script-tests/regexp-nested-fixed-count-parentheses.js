@@ -0,0 +1,30 @@
+description(
+"Tests deeply nested parentheses with fixed counts. Compiling them must not take time or memory exponential in the nesting depth."
+);
+
+function repeat(string, count)
+{
+    var result = "";
+    for (var i = 0; i < count; ++i)
+        result += string;
+    return result;
+}
+
+var deeplyNested = new RegExp("(?:(?:(?:(?:(?:(?:(?:x){8}){8}){8}){8}){8}){8}){8}");
+shouldBeFalse("deeplyNested.test('x')");
+shouldBeFalse("deeplyNested.test(repeat('x', 4096))");
+
+var nestedFourTimes = /^(?:(?:(?:(?:x){8}){8}){8}){8}$/;
+shouldBeTrue("nestedFourTimes.test(repeat('x', 4096))");
+shouldBeFalse("nestedFourTimes.test(repeat('x', 4095))");
+shouldBeFalse("nestedFourTimes.test(repeat('x', 4097))");
+
+var nestedSevenTimes = /^(?:(?:(?:(?:(?:(?:(?:ab){2}){2}){2}){2}){2}){2}){2}$/;
+shouldBeTrue("nestedSevenTimes.test(repeat('ab', 128))");
+shouldBeFalse("nestedSevenTimes.test(repeat('ab', 127))");
+
+shouldBe("/(?:(?:ab){3}c){2}/.exec('xabababcabababcy')[0]", "'abababcabababc'");
+shouldBe("/(?:(?:a|b){2}(c)){3}/.exec('abcbacaac')", "['abcbacaac', 'c']");
+shouldBeNull("/(?:(?:a|b){2}c){3}/.exec('abcbacac')");
+
+var successfullyParsed = true;
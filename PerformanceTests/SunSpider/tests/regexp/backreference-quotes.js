@@ -0,0 +1,10 @@
+var source = "";
+for (var i = 0; i < 1000; ++i)
+    source += "var s" + i + " = " + (i % 2 ? "'single " + i + "'" : "\"double " + i + "\"") + "; ";
+
+var quoted = /(["'])([^"'\\]*)\1/g;
+var length = 0;
+for (var i = 0; i < 25; ++i) {
+    var strings = source.match(quoted);
+    length += strings.length;
+}
@@ -0,0 +1,15 @@
+var words = ["the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "and", "then"];
+var text = "";
+for (var i = 0; i < 2000; ++i) {
+    text += words[i % words.length] + " ";
+    if (i % 37 == 0)
+        text += words[i % words.length] + " ";
+}
+
+var repeated = /\b(\w+)\s+\1\b/g;
+var count = 0;
+for (var i = 0; i < 25; ++i) {
+    repeated.lastIndex = 0;
+    while (repeated.exec(text))
+        ++count;
+}
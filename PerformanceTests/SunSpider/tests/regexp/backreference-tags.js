@@ -0,0 +1,13 @@
+var tags = ["b", "i", "em", "span", "strong", "code"];
+var markup = "";
+for (var i = 0; i < 1000; ++i) {
+    var tag = tags[i % tags.length];
+    markup += "<" + tag + " class=\"c" + i + "\">text " + i + "</" + tag + "> ";
+    if (i % 10 == 0)
+        markup += "<p>unclosed " + i + "</div> ";
+}
+
+var element = /<(\w+)[^>]*>([^<]*)<\/\1>/g;
+var stripped;
+for (var i = 0; i < 20; ++i)
+    stripped = markup.replace(element, "$2");
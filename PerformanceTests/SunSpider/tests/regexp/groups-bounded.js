@@ -0,0 +1,13 @@
+var numbers = "";
+for (var i = 0; i < 1000; ++i) {
+    numbers += (i % 3 ? "+1 " : "") + "(" + (200 + i % 800) + ") " + (100 + i % 900) + "-" + (1000 + i) + ", ";
+    numbers += "x" + (i % 2 ? "abab" : "ab") + "y ";
+}
+
+var phone = /(?:\+\d{1,2}\s)?\(?\d{3}\)?[\s.-]\d{3}[\s.-]\d{4}/g;
+var pairs = /x(?:ab){1,2}y/g;
+var found = 0;
+for (var i = 0; i < 10; ++i) {
+    found += numbers.match(phone).length;
+    found += numbers.match(pairs).length;
+}
@@ -0,0 +1,15 @@
+var log = "";
+for (var i = 0; i < 1000; ++i) {
+    log += "10." + (i % 256) + "." + ((i * 7) % 256) + "." + ((i * 13) % 256) + " - ";
+    log += "0000abcd-" + (1000 + i) + "-4e5f-a6b7-0123456789ab 2011-0" + (1 + i % 9) + "-1" + (i % 10) + "\n";
+}
+
+var address = /(?:\d{1,3}\.){3}\d{1,3}/g;
+var uuid = /[0-9a-f]{8}(?:-[0-9a-f]{4}){3}-[0-9a-f]{12}/g;
+var date = /(?:\d\d){2}-\d\d-\d\d/g;
+var found = 0;
+for (var i = 0; i < 10; ++i) {
+    found += log.match(address).length;
+    found += log.match(uuid).length;
+    found += log.match(date).length;
+}
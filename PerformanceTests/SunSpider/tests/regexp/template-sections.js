@@ -0,0 +1,13 @@
+var template = "";
+for (var i = 0; i < 200; ++i)
+    template += "<li>{{#item" + (i % 5) + "}}{{name}} costs {{price}}{{/item" + (i % 5) + "}}</li>{{#missing}}never{{/other}} ";
+
+var section = /\{\{#(\w+)\}\}([\s\S]*?)\{\{\/\1\}\}/g;
+var variable = /\{\{(\w+)\}\}/g;
+var values = { name: "widget", price: "$1" };
+var output;
+for (var i = 0; i < 5; ++i) {
+    output = template.replace(section, function(match, name, body) {
+        return body.replace(variable, function(match, key) { return values[key]; });
+    });
+}
@@ -0,0 +1,18 @@
+var addresses = [];
+for (var i = 0; i < 500; ++i) {
+    addresses.push("user" + i + "@example" + (i % 7) + ".com");
+    addresses.push("first.last+" + i + "@mail.sub" + i + ".example.org");
+    addresses.push("broken" + i + "@@example.com");
+}
+
+var email = /^[\w.+-]+@(?:[\w-]+\.)+[a-z]{2,}$/;
+var hexColor = /^#(?:[0-9a-f]{3}){1,2}$/i;
+var valid = 0;
+for (var i = 0; i < 20; ++i) {
+    for (var j = 0; j < addresses.length; ++j) {
+        if (email.test(addresses[j]))
+            ++valid;
+        if (hexColor.test(j % 2 ? "#a0b1c2" : "#abg"))
+            ++valid;
+    }
+}
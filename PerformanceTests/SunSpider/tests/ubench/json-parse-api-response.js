@@ -0,0 +1,20 @@
+// A paginated API response: many records of the same shape, with nested
+// objects, arrays, escaped text and a mix of integer and fractional numbers.
+var records = [];
+for (var i = 0; i < 3000; ++i) {
+    records.push({
+        id: 100000 + i,
+        created_at: "2011-06-" + (10 + i % 20) + "T12:" + (10 + i % 50) + ":00Z",
+        text: "Status update number " + i + " with a \"quoted\" phrase,\na newline and a tab\t.",
+        user: { id: i % 97, screen_name: "user" + (i % 97), followers_count: i * 13 % 5000, verified: !(i % 7), location: null },
+        entities: { hashtags: ["tag" + (i % 11), "tag" + (i % 5)], urls: [], user_mentions: [{ id: i % 31, indices: [3, 12] }] },
+        coordinates: [37.7749 + i / 10000, -122.4194 - i / 10000],
+        retweet_count: i % 250,
+        favorited: false
+    });
+}
+var payload = JSON.stringify({ results: records, next_page: "?page=2&max_id=1234567890", completed_in: 0.073 });
+
+var total = 0;
+for (var n = 0; n < 10; ++n)
+    total += JSON.parse(payload).results.length;
@@ -0,0 +1,17 @@
+// Serializing application state: many objects of a few shapes, mostly
+// integers and short strings, as done when persisting or posting a model.
+var state = { version: 3, items: [], selection: { start: 0, end: 10, anchor: "item12" } };
+for (var i = 0; i < 3000; ++i) {
+    state.items.push({
+        id: i,
+        title: "Item " + i,
+        done: !(i % 3),
+        tags: ["t" + (i % 7), "t" + (i % 11)],
+        position: { x: i % 640, y: i % 480, z: -i },
+        note: i % 10 ? null : "Needs a \"review\" before\nrelease"
+    });
+}
+
+var length = 0;
+for (var n = 0; n < 40; ++n)
+    length += JSON.stringify(state).length;
@@ -0,0 +1,19 @@
+// Chart and data-grid code: fractional values are formatted for labels and
+// serialized as JSON, and the text is parsed back with parseFloat and JSON.parse.
+var values = [];
+var seed = 49734321;
+for (var i = 0; i < 2000; ++i) {
+    seed = (seed * 69069 + 1) % 4294967296;
+    values.push((seed / 4294967296 - 0.5) * Math.pow(10, i % 12 - 4));
+}
+
+var total = 0;
+for (var iteration = 0; iteration < 25; ++iteration) {
+    var labels = [];
+    for (var i = 0; i < values.length; ++i)
+        labels.push(String(values[i] * (iteration + 1)));
+    for (var i = 0; i < labels.length; ++i)
+        total += parseFloat(labels[i]);
+    var json = JSON.stringify(values);
+    total += JSON.parse(json)[iteration];
+}
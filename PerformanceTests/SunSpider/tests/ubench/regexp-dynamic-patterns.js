@@ -0,0 +1,18 @@
+// Templating code that builds its regular expressions from strings: a working
+// set of placeholder patterns is rebuilt constantly, while one-off search
+// patterns stream through. The working set should stay compiled in the cache.
+var text = "";
+for (var k = 0; k < 150; ++k)
+    text += "{{field" + k + "}} ";
+
+var found = 0;
+for (var i = 0; i < 60000; ++i) {
+    var re = new RegExp("\\{\\{field" + (i % 150) + "\\}\\}");
+    if (re.test(text))
+        ++found;
+    if (!(i % 4)) {
+        var search = new RegExp("term" + i + "|\\bword" + i, "i");
+        if (search.test(text))
+            ++found;
+    }
+}
@@ -0,0 +1,13 @@
+// Long-lived pages keep compiling fresh regular expressions (templating,
+// filters built from user input), so JIT code is continually generated and
+// released. This churns executable memory through many short-lived patterns.
+var words = ["alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta"];
+var text = words.join(" ") + " 12345 end";
+
+var matches = 0;
+for (var i = 0; i < 20000; ++i) {
+    var word = words[i % words.length];
+    var re = new RegExp("(" + word + ")\\s+(\\w+)|" + (i % 997) + "(\\d*)", i & 1 ? "g" : "");
+    if (re.exec(text))
+        ++matches;
+}
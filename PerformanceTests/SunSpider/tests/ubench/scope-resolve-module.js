@@ -0,0 +1,38 @@
+// Module-pattern code reaching for globals: a library namespace and Math.
+// One module reads its configuration with eval, and JSONP-style callbacks are
+// added to and deleted from the global object while the modules run.
+var global = this;
+global.Lib = { scale: 3, offset: 1 };
+
+var Counter = (function() {
+    var count = 0;
+    function step(i) { return Math.max(i & 7, Lib.scale) + count; }
+    return {
+        run: function(n) {
+            var total = 0;
+            for (var i = 0; i < n; ++i) {
+                total += step(i);
+                ++count;
+            }
+            return total;
+        }
+    };
+})();
+
+var Configured = (function() {
+    function run(n, text) {
+        var config = eval("(" + text + ")");
+        var total = 0;
+        for (var i = 0; i < n; ++i)
+            total += Math.abs(i - Lib.offset) + Lib.scale + config.limit;
+        return total;
+    }
+    return { run: run };
+})();
+
+var result = 0;
+for (var request = 0; request < 200; ++request) {
+    global["jsonp" + request] = function() { };
+    result += Counter.run(1000) + Configured.run(1000, "{ limit: " + request + " }");
+    delete global["jsonp" + request];
+}
@@ -0,0 +1,16 @@
+var rows = [];
+for (var i = 0; i < 2000; ++i)
+    rows.push("<tr><td class='name'>item" + i + "</td><td class='price'>" + (i * 3 % 97) + "</td></tr>\n");
+
+var count = 0;
+for (var n = 0; n < 100; ++n) {
+    var html = "<table>\n";
+    for (var i = 0; i < rows.length; ++i)
+        html += rows[i];
+    html += "</table>\n";
+
+    for (var start = 0; (start = html.indexOf("\n", start)) != -1; ++start) {
+        if (html.charAt(start + 1) == "<")
+            ++count;
+    }
+}
@@ -0,0 +1,13 @@
+var text = "";
+for (var i = 0; i < 5000; ++i)
+    text += "line " + i + ": the quick brown fox jumps over the lazy dog\n";
+
+var total = 0;
+for (var n = 0; n < 2000; ++n) {
+    var rest = text;
+    for (var i = 0; i < 50; ++i) {
+        var end = rest.indexOf("\n");
+        total += rest.substring(0, end).length;
+        rest = rest.substring(end + 1);
+    }
+}
@@ -31,6 +31,8 @@
 #include "CodeBlock.h"
 
 #include "BytecodeGenerator.h"
+#include "DFGByteCodeParser.h"
+#include "DFGJITCompiler.h"
 #include "Debugger.h"
 #include "Interpreter.h"
 #include "JIT.h"
@@ -252,6 +254,9 @@ static void printStructureStubInfo(const StructureStubInfo& stubInfo, unsigned i
     case access_put_by_id_replace:
         printf("  [%4d] %s: %s\n", instructionOffset, "put_by_id_replace", pointerToSourceString(stubInfo.u.putByIdReplace.baseObjectStructure).utf8().data());
         return;
+    case access_put_by_id_replace_list:
+        printf("  [%4d] %s: %s (%d)\n", instructionOffset, "op_put_by_id_replace_list", pointerToSourceString(stubInfo.u.putByIdReplaceList.structureList).utf8().data(), stubInfo.u.putByIdReplaceList.listSize);
+        return;
     case access_get_by_id:
         printf("  [%4d] %s\n", instructionOffset, "get_by_id");
         return;
@@ -1225,6 +1230,27 @@ void CodeBlock::dump(ExecState* exec, const Vector<Instruction>::const_iterator&
             printf("[%4d] profile_did_call\t %s\n", location, registerName(exec, function).data());
             break;
         }
+        case op_mov_mov: {
+            int r0 = (++it)->u.operand;
+            int r1 = (++it)->u.operand;
+            printf("[%4d] mov_mov\t\t %s, %s\n", location, registerName(exec, r0).data(), registerName(exec, r1).data());
+            break;
+        }
+        case op_add_mov: {
+            printBinaryOp(exec, location, it, "add_mov");
+            ++it;
+            break;
+        }
+        case op_bitand_jfalse: {
+            printBinaryOp(exec, location, it, "bitand_jfalse");
+            ++it;
+            break;
+        }
+        case op_pre_inc_loop_if_less: {
+            int r0 = (++it)->u.operand;
+            printf("[%4d] pre_inc_loop_if_less\t %s\n", location, registerName(exec, r0).data());
+            break;
+        }
         case op_end: {
             int r0 = (++it)->u.operand;
             printf("[%4d] end\t\t %s\n", location, registerName(exec, r0).data());
@@ -1379,6 +1405,10 @@ CodeBlock::CodeBlock(ScriptExecutable* ownerExecutable, CodeType codeType, JSGlo
     , m_codeType(codeType)
     , m_source(sourceProvider)
     , m_sourceOffset(sourceOffset)
+#if ENABLE(DFG_JIT)
+    , m_loopOptimizationState(LoopOptimizationNotApplicable)
+    , m_optimizationCounter(0)
+#endif
     , m_symbolTable(symTab)
 {
     ASSERT(m_source);
@@ -1618,6 +1648,52 @@ bool CodeBlock::hasGlobalResolveInfoAtBytecodeOffset(unsigned bytecodeOffset)
 }
 #endif
 
+#if ENABLE(DFG_JIT)
+bool CodeBlock::optimizeLoops(JSGlobalData* globalData)
+{
+    ASSERT(m_loopOptimizationState == LoopOptimizationPending);
+    ASSERT(!m_optimizedCode);
+
+    bool canOptimize = true;
+#if ENABLE(DFG_JIT_RESTRICTIONS)
+    // FIXME: temporarily disable property accesses until we fix regressions.
+    if (numberOfStructureStubInfos())
+        canOptimize = false;
+#endif
+
+    DFG::Graph dfg;
+    if (canOptimize && DFG::parse(dfg, globalData, this)) {
+        m_optimizedCode = adoptPtr(new OptimizedCode);
+        DFG::JITCompiler dataFlowJIT(globalData, dfg, this);
+        dataFlowJIT.compileForLoopEntry(m_optimizedCode->jitCode, m_optimizedCode->loopEntries, m_optimizedCode->callReturnIndexVector);
+        m_loopOptimizationState = LoopOptimizationSucceeded;
+    } else
+        m_loopOptimizationState = LoopOptimizationFailed;
+
+    // Nothing further will be generated from the bytecode.
+#if !ENABLE(OPCODE_SAMPLING)
+    if (!BytecodeGenerator::dumpsGeneratedCode())
+        discardBytecode();
+#endif
+
+    return m_loopOptimizationState == LoopOptimizationSucceeded;
+}
+
+void* CodeBlock::optimizedLoopEntry(unsigned bytecodeOffset)
+{
+    if (!m_optimizedCode)
+        return 0;
+    // There are few loops in any one CodeBlock, and the baseline JIT may plant checks at
+    // loop headers the DFG JIT does not recognize, so a simple search will do.
+    Vector<OptimizedLoopEntry>& loopEntries = m_optimizedCode->loopEntries;
+    for (size_t i = 0; i < loopEntries.size(); ++i) {
+        if (loopEntries[i].bytecodeOffset == bytecodeOffset)
+            return loopEntries[i].entry.executableAddress();
+    }
+    return 0;
+}
+#endif
+
 void CodeBlock::shrinkToFit()
 {
     m_instructions.shrinkToFit();
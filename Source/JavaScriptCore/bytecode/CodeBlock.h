@@ -199,6 +199,21 @@ namespace JSC {
     }
 #endif
 
+#if ENABLE(DFG_JIT)
+    // This structure records a point in optimized code at which execution of a
+    // loop may continue, having been started in the code generated by the old JIT.
+    struct OptimizedLoopEntry {
+        OptimizedLoopEntry(unsigned bytecodeOffset, MacroAssemblerCodePtr entry)
+            : bytecodeOffset(bytecodeOffset)
+            , entry(entry)
+        {
+        }
+
+        unsigned bytecodeOffset;
+        MacroAssemblerCodePtr entry;
+    };
+#endif
+
     class CodeBlock {
         WTF_MAKE_FAST_ALLOCATED;
         friend class JIT;
@@ -262,6 +277,17 @@ namespace JSC {
 
         unsigned bytecodeOffset(ReturnAddressPtr returnAddress)
         {
+#if ENABLE(DFG_JIT)
+            if (m_optimizedCode) {
+                uintptr_t offset = reinterpret_cast<uintptr_t>(returnAddress.value()) - reinterpret_cast<uintptr_t>(m_optimizedCode->jitCode.start());
+                if (offset < m_optimizedCode->jitCode.size()) {
+                    Vector<CallReturnOffsetToBytecodeOffset>& callIndices = m_optimizedCode->callReturnIndexVector;
+                    if (!callIndices.size())
+                        return 1;
+                    return binarySearch<CallReturnOffsetToBytecodeOffset, unsigned, getCallReturnOffset>(callIndices.begin(), callIndices.size(), static_cast<unsigned>(offset))->bytecodeOffset;
+                }
+            }
+#endif
             if (!m_rareData)
                 return 1;
             Vector<CallReturnOffsetToBytecodeOffset>& callIndices = m_rareData->m_callReturnIndexVector;
@@ -283,6 +309,39 @@ namespace JSC {
         Vector<Instruction>& instructions() { return m_instructions; }
         void discardBytecode() { m_instructions.clear(); }
 
+#if ENABLE(DFG_JIT)
+        // Loops in code generated by the old JIT count their iterations; once hot, the
+        // CodeBlock is compiled by the DFG JIT, and execution continues in the optimized
+        // code from the head of the loop (see cti_optimize_from_loop).
+        enum LoopOptimizationState { LoopOptimizationNotApplicable, LoopOptimizationPending, LoopOptimizationFailed, LoopOptimizationSucceeded };
+        static const int32_t loopOptimizationThreshold = 1000;
+
+        LoopOptimizationState loopOptimizationState() { return m_loopOptimizationState; }
+        void setLoopOptimizationPending()
+        {
+            m_loopOptimizationState = LoopOptimizationPending;
+            m_optimizationCounter = -loopOptimizationThreshold;
+        }
+        int32_t* addressOfOptimizationCounter() { return &m_optimizationCounter; }
+        void deferLoopOptimization() { m_optimizationCounter = -loopOptimizationThreshold; }
+        // Once optimized code exists, enter it on the next execution of a loop header.
+        void enterOptimizedLoopsEagerly() { m_optimizationCounter = -1; }
+
+        // Compile the optimized code; returns false if this is not possible.
+        bool optimizeLoops(JSGlobalData*);
+        // Returns 0 if execution cannot continue in optimized code at this loop header.
+        void* optimizedLoopEntry(unsigned bytecodeOffset);
+#endif
+        // The bytecode is retained while it may still be needed to generate optimized code.
+        bool mayOptimizeLoops()
+        {
+#if ENABLE(DFG_JIT)
+            return m_loopOptimizationState == LoopOptimizationPending;
+#else
+            return false;
+#endif
+        }
+
 #ifndef NDEBUG
         unsigned instructionCount() { return m_instructionCount; }
         void setInstructionCount(unsigned instructionCount) { m_instructionCount = instructionCount; }
@@ -524,6 +583,19 @@ namespace JSC {
 
         Vector<unsigned> m_jumpTargets;
 
+#if ENABLE(DFG_JIT)
+        struct OptimizedCode {
+            WTF_MAKE_FAST_ALLOCATED;
+        public:
+            JITCode jitCode;
+            Vector<OptimizedLoopEntry> loopEntries;
+            Vector<CallReturnOffsetToBytecodeOffset> callReturnIndexVector;
+        };
+        LoopOptimizationState m_loopOptimizationState;
+        int32_t m_optimizationCounter;
+        OwnPtr<OptimizedCode> m_optimizedCode;
+#endif
+
         // Constant Pool
         Vector<Identifier> m_identifiers;
         COMPILE_ASSERT(sizeof(Register) == sizeof(WriteBarrier<Unknown>), Register_must_be_same_size_as_WriteBarrier_Unknown);
@@ -36,7 +36,7 @@
 #include "StructureChain.h"
 #include <wtf/VectorTraits.h>
 
-#define POLYMORPHIC_LIST_CACHE_SIZE 8
+#define POLYMORPHIC_LIST_CACHE_SIZE 16
 
 namespace JSC {
 
@@ -55,6 +55,7 @@ namespace JSC {
     class StructureChain;
 
     // Structure used by op_get_by_id_self_list and op_get_by_id_proto_list instruction to hold data off the main opcode stream.
+    // The JIT also uses it for polymorphic put_by_id replace stubs, in which case only 'base' is set.
     struct PolymorphicAccessStructureList {
         WTF_MAKE_FAST_ALLOCATED;
     public:
@@ -193,6 +193,11 @@ namespace JSC {
         macro(op_profile_will_call, 2) \
         macro(op_profile_did_call, 2) \
         \
+        macro(op_mov_mov, 3) \
+        macro(op_add_mov, 5) \
+        macro(op_bitand_jfalse, 5) \
+        macro(op_pre_inc_loop_if_less, 2) \
+        \
         macro(op_end, 2) // end must be the last opcode in the list
 
     #define OPCODE_ID_ENUM(opcode, length) opcode,
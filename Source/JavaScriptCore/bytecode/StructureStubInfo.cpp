@@ -45,6 +45,11 @@ void StructureStubInfo::deref()
         delete polymorphicStructures;
         return;
     }
+    case access_put_by_id_replace_list: {
+        PolymorphicAccessStructureList* polymorphicStructures = u.putByIdReplaceList.structureList;
+        delete polymorphicStructures;
+        return;
+    }
     case access_get_by_id_self:
     case access_get_by_id_proto:
     case access_get_by_id_chain:
@@ -95,6 +100,11 @@ void StructureStubInfo::markAggregate(MarkStack& markStack)
     case access_put_by_id_replace:
         markStack.append(&u.putByIdReplace.baseObjectStructure);
         return;
+    case access_put_by_id_replace_list: {
+        PolymorphicAccessStructureList* polymorphicStructures = u.putByIdReplaceList.structureList;
+        polymorphicStructures->markAggregate(markStack, u.putByIdReplaceList.listSize);
+        return;
+    }
     case access_get_by_id:
     case access_put_by_id:
     case access_get_by_id_generic:
@@ -43,6 +43,7 @@ namespace JSC {
         access_get_by_id_proto_list,
         access_put_by_id_transition,
         access_put_by_id_replace,
+        access_put_by_id_replace_list,
         access_get_by_id,
         access_put_by_id,
         access_get_by_id_generic,
@@ -115,6 +116,14 @@ namespace JSC {
             u.putByIdReplace.baseObjectStructure.set(globalData, owner, baseObjectStructure);
         }
 
+        void initPutByIdReplaceList(PolymorphicAccessStructureList* structureList, int listSize)
+        {
+            accessType = access_put_by_id_replace_list;
+
+            u.putByIdReplaceList.structureList = structureList;
+            u.putByIdReplaceList.listSize = listSize;
+        }
+
         void deref();
         void markAggregate(MarkStack&);
 
@@ -159,6 +168,10 @@ namespace JSC {
             struct {
                 WriteBarrierBase<Structure> baseObjectStructure;
             } putByIdReplace;
+            struct {
+                PolymorphicAccessStructureList* structureList;
+                int listSize;
+            } putByIdReplaceList;
         } u;
 
         CodeLocationLabel stubRoutine;
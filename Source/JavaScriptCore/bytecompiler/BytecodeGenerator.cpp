@@ -150,6 +150,11 @@ JSObject* BytecodeGenerator::generate()
         m_codeBlock->dump(m_scopeChain->globalObject->globalExec());
 #endif
 
+#if ENABLE(INTERPRETER)
+    if (!m_globalData->canUseJIT())
+        fuseInstructionPairs();
+#endif
+
     if ((m_codeType == FunctionCode && !m_codeBlock->needsFullScopeChain() && !m_codeBlock->usesArguments()) || m_codeType == EvalCode)
         symbolTable().clear();
 
@@ -160,6 +165,48 @@ JSObject* BytecodeGenerator::generate()
     return 0;
 }
 
+#if ENABLE(INTERPRETER)
+// The interpreter executes some frequent pairs of adjacent instructions in a
+// single handler, saving a dispatch. Only the first opcode is replaced; the
+// second instruction stays in place, so branches to it and bytecode offsets
+// are unaffected.
+void BytecodeGenerator::fuseInstructionPairs()
+{
+    Interpreter* interpreter = m_globalData->interpreter;
+    Vector<Instruction>& instructions = this->instructions();
+
+    size_t next;
+    for (size_t i = 0; i < instructions.size(); i = next) {
+        OpcodeID opcodeID = interpreter->getOpcodeID(instructions[i].u.opcode);
+        next = i + opcodeLengths[opcodeID];
+        if (next >= instructions.size())
+            break;
+
+        OpcodeID nextOpcodeID = interpreter->getOpcodeID(instructions[next].u.opcode);
+        switch (opcodeID) {
+        case op_mov:
+            if (nextOpcodeID == op_mov)
+                instructions[i] = interpreter->getOpcode(op_mov_mov);
+            break;
+        case op_add:
+            if (nextOpcodeID == op_mov)
+                instructions[i] = interpreter->getOpcode(op_add_mov);
+            break;
+        case op_bitand:
+            if (nextOpcodeID == op_jfalse && instructions[next + 1].u.operand == instructions[i + 1].u.operand)
+                instructions[i] = interpreter->getOpcode(op_bitand_jfalse);
+            break;
+        case op_pre_inc:
+            if (nextOpcodeID == op_loop_if_less)
+                instructions[i] = interpreter->getOpcode(op_pre_inc_loop_if_less);
+            break;
+        default:
+            break;
+        }
+    }
+}
+#endif
+
 bool BytecodeGenerator::addVar(const Identifier& ident, bool isConstant, RegisterID*& r0)
 {
     int index = m_calleeRegisters.size();
@@ -1132,8 +1179,13 @@ RegisterID* BytecodeGenerator::emitLoad(RegisterID* dst, JSValue v)
 
 bool BytecodeGenerator::findScopedProperty(const Identifier& property, int& index, size_t& stackDepth, bool forWriting, bool& requiresDynamicChecks, JSObject*& globalObject)
 {
+    // A function that calls eval can only have names added to its own activation,
+    // so the rest of the scope chain is still known; lookups that reach the global
+    // object just have to check that activation at run time.
+    bool ownScopeIsDynamic = m_codeType == FunctionCode && !m_dynamicScopeDepth && m_codeBlock->usesEval();
+
     // Cases where we cannot statically optimize the lookup.
-    if (property == propertyNames().arguments || !canOptimizeNonLocals()) {
+    if (property == propertyNames().arguments || (!canOptimizeNonLocals() && !ownScopeIsDynamic)) {
         stackDepth = 0;
         index = missingSymbolMarker();
 
@@ -1145,8 +1197,9 @@ bool BytecodeGenerator::findScopedProperty(const Identifier& property, int& inde
         return false;
     }
 
+    ASSERT(!ownScopeIsDynamic || m_codeBlock->needsFullScopeChain());
     size_t depth = 0;
-    requiresDynamicChecks = false;
+    requiresDynamicChecks = ownScopeIsDynamic;
     ScopeChainIterator iter = m_scopeChain->begin();
     ScopeChainIterator end = m_scopeChain->end();
     for (; iter != end; ++iter, ++depth) {
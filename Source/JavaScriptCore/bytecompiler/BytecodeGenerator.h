@@ -402,6 +402,9 @@ namespace JSC {
 
     private:
         void emitOpcode(OpcodeID);
+#if ENABLE(INTERPRETER)
+        void fuseInstructionPairs();
+#endif
         void retrieveLastBinaryOp(int& dstIndex, int& src1Index, int& src2Index);
         void retrieveLastUnaryOp(int& dstIndex, int& srcIndex);
         ALWAYS_INLINE void rewindBinaryOp();
@@ -95,6 +95,12 @@ public:
         m_candidateAliasGetByVal = NoNode;
     }
 
+    void recordCall(NodeIndex call)
+    {
+        ASSERT_UNUSED(call, m_graph[call].op == Call || m_graph[call].op == Construct);
+        m_candidateAliasGetByVal = NoNode;
+    }
+
 private:
     // This method returns true for arguments:
     //   - (X, X)
@@ -55,6 +55,8 @@ public:
         , m_constantUndefined(UINT_MAX)
         , m_constantNull(UINT_MAX)
         , m_constant1(UINT_MAX)
+        , m_lastCall(NoNode)
+        , m_globalResolveNumber(0)
         , m_constants(codeBlock->numberOfConstantRegisters())
         , m_arguments(codeBlock->m_numParameters)
         , m_variables(codeBlock->m_numVars)
@@ -70,6 +72,8 @@ public:
 private:
     // Parse a single basic block of bytecode instructions.
     bool parseBlock(unsigned limit);
+    // Mark blocks that are the target of a backwards branch as loop headers.
+    void markLoopHeaders();
 
     // Get/Set the operands/result of a bytecode instruction.
     NodeIndex get(int operand)
@@ -427,6 +431,33 @@ private:
     }
 
 
+    // Add a Call or Construct node; the callee frame for the call is laid out
+    // by the bytecode at 'registerOffset', preceded by its 'argCount' arguments
+    // (the first of which is the this value).
+    NodeIndex addCall(NodeType op, Instruction* currentInstruction)
+    {
+        NodeIndex callee = get(currentInstruction[1].u.operand);
+        int argCount = currentInstruction[2].u.operand;
+        int registerOffset = currentInstruction[3].u.operand;
+        int firstArgument = registerOffset - RegisterFile::CallFrameHeaderSize - argCount;
+
+        m_graph.m_varArgChildren.append(callee);
+        // The this value for a construct is left uninitialized by the bytecode, it is
+        // allocated by the callee.
+        m_graph.m_varArgChildren.append(op == Construct ? constantUndefined() : get(firstArgument));
+        for (int argument = 1; argument < argCount; ++argument)
+            m_graph.m_varArgChildren.append(get(firstArgument + argument));
+
+        // Reserve space for the callee's arguments & call frame header, beyond all
+        // other registers used by this function.
+        unsigned parameterSlots = argCount + RegisterFile::CallFrameHeaderSize;
+        if (m_graph.m_parameterSlots < parameterSlots)
+            m_graph.m_parameterSlots = parameterSlots;
+
+        m_lastCall = addVarArgToGraph(op, argCount + 1);
+        return m_lastCall;
+    }
+
     // These methods create a node and add it to the graph. If nodes of this type are
     // 'mustGenerate' then the node  will implicitly be ref'ed to ensure generation.
     NodeIndex addToGraph(NodeType op, NodeIndex child1 = NoNode, NodeIndex child2 = NoNode, NodeIndex child3 = NoNode)
@@ -456,6 +487,18 @@ private:
             m_graph.ref(resultIndex);
         return resultIndex;
     }
+    // Add a node whose 'numChildren' children have just been appended to m_varArgChildren.
+    NodeIndex addVarArgToGraph(NodeType op, unsigned numChildren)
+    {
+        ASSERT(op & NodeHasVarArgs);
+        ASSERT(numChildren <= m_graph.m_varArgChildren.size());
+        NodeIndex resultIndex = (NodeIndex)m_graph.size();
+        m_graph.append(Node(op, m_currentIndex, m_graph.m_varArgChildren.size() - numChildren, numChildren));
+
+        if (op & NodeMustGenerate)
+            m_graph.ref(resultIndex);
+        return resultIndex;
+    }
 
     JSGlobalData* m_globalData;
     CodeBlock* m_codeBlock;
@@ -476,6 +519,12 @@ private:
     unsigned m_constantNull;
     unsigned m_constant1;
 
+    // The most recent Call or Construct node, consumed by a subsequent op_call_put_result.
+    NodeIndex m_lastCall;
+    // The number of op_resolve_global instructions seen so far, used to find the
+    // corresponding GlobalResolveInfo in the CodeBlock.
+    unsigned m_globalResolveNumber;
+
     // A constant in the constant pool may be represented by more than one
     // node in the graph, depending on the context in which it is being used.
     struct ConstantRecord {
@@ -868,6 +917,55 @@ bool ByteCodeParser::parseBlock(unsigned limit)
             NEXT_OPCODE(op_put_global_var);
         }
 
+        case op_resolve_global: {
+            unsigned globalResolveNumber = m_globalResolveNumber++;
+            ASSERT(m_codeBlock->globalResolveInfo(globalResolveNumber).bytecodeOffset == m_currentIndex);
+            NodeIndex resolve = addToGraph(ResolveGlobal, OpInfo(currentInstruction[2].u.operand), OpInfo(globalResolveNumber));
+            set(currentInstruction[1].u.operand, resolve);
+            NEXT_OPCODE(op_resolve_global);
+        }
+
+        case op_method_check:
+            // The subsequent op_get_by_id is sufficient; no need to cache the method here.
+            NEXT_OPCODE(op_method_check);
+
+        // === Object & array allocation ===
+
+        case op_new_object: {
+            set(currentInstruction[1].u.operand, addToGraph(NewObject));
+            NEXT_OPCODE(op_new_object);
+        }
+
+        case op_new_array: {
+            int firstArgument = currentInstruction[2].u.operand;
+            int argCount = currentInstruction[3].u.operand;
+            for (int argument = 0; argument < argCount; ++argument)
+                m_graph.m_varArgChildren.append(get(firstArgument + argument));
+            if (m_graph.m_parameterSlots < (unsigned)argCount)
+                m_graph.m_parameterSlots = argCount;
+            set(currentInstruction[1].u.operand, addVarArgToGraph(NewArray, argCount));
+            NEXT_OPCODE(op_new_array);
+        }
+
+        // === Calls ===
+
+        case op_call: {
+            NodeIndex call = addCall(Call, currentInstruction);
+            aliases.recordCall(call);
+            NEXT_OPCODE(op_call);
+        }
+
+        case op_construct: {
+            NodeIndex call = addCall(Construct, currentInstruction);
+            aliases.recordCall(call);
+            NEXT_OPCODE(op_construct);
+        }
+
+        case op_call_put_result:
+            ASSERT(m_lastCall != NoNode);
+            set(currentInstruction[1].u.operand, m_lastCall);
+            NEXT_OPCODE(op_call_put_result);
+
         // === Block terminators. ===
 
         case op_jmp: {
@@ -1001,6 +1099,23 @@ bool ByteCodeParser::parseBlock(unsigned limit)
     }
 }
 
+void ByteCodeParser::markLoopHeaders()
+{
+    for (BlockIndex blockIndex = 0; blockIndex < m_graph.m_blocks.size(); ++blockIndex) {
+        BasicBlock& block = m_graph.m_blocks[blockIndex];
+        ASSERT(block.end > block.begin);
+        Node& terminal = m_graph[block.end - 1];
+        if (terminal.isJump() || terminal.isBranch()) {
+            if (terminal.takenBytecodeOffset() <= block.bytecodeBegin)
+                m_graph.m_blocks[m_graph.blockIndexForBytecodeOffset(terminal.takenBytecodeOffset())].isLoopHeader = true;
+        }
+        if (terminal.isBranch()) {
+            if (terminal.notTakenBytecodeOffset() <= block.bytecodeBegin)
+                m_graph.m_blocks[m_graph.blockIndexForBytecodeOffset(terminal.notTakenBytecodeOffset())].isLoopHeader = true;
+        }
+    }
+}
+
 bool ByteCodeParser::parse()
 {
     // Set during construction.
@@ -1029,6 +1144,8 @@ bool ByteCodeParser::parse()
     // Should have reached the end of the instructions.
     ASSERT(m_currentIndex == m_codeBlock->instructions().size());
 
+    markLoopHeaders();
+
     // Assign VirtualRegisters.
     ScoreBoard scoreBoard(m_graph, m_variables.size());
     Node* nodes = m_graph.begin();
@@ -1040,9 +1157,14 @@ bool ByteCodeParser::parse()
             // allocate a VirtualRegister for this node. We do so in this
             // order so that if a child is on its last use, and a
             // VirtualRegister is freed, then it may be reused for node.
-            scoreBoard.use(node.child1);
-            scoreBoard.use(node.child2);
-            scoreBoard.use(node.child3);
+            if (node.hasVarArgs()) {
+                for (unsigned child = node.firstChild(); child < node.firstChild() + node.numChildren(); ++child)
+                    scoreBoard.use(m_graph.m_varArgChildren[child]);
+            } else {
+                scoreBoard.use(node.child1);
+                scoreBoard.use(node.child2);
+                scoreBoard.use(node.child3);
+            }
             node.virtualRegister = scoreBoard.allocate();
             // 'mustGenerate' nodes have their useCount artificially elevated,
             // call use now to account for this.
@@ -1054,7 +1176,8 @@ bool ByteCodeParser::parse()
     // 'm_numCalleeRegisters' is the number of locals and temporaries allocated
     // for the function (and checked for on entry). Since we perform a new and
     // different allocation of temporaries, more registers may now be required.
-    unsigned calleeRegisters = scoreBoard.allocatedCount() + m_variables.size();
+    // Outgoing call frames are placed above all of these (see JITCodeGenerator::emitCall).
+    unsigned calleeRegisters = scoreBoard.allocatedCount() + m_variables.size() + m_graph.m_parameterSlots;
     if ((unsigned)m_codeBlock->m_numCalleeRegisters < calleeRegisters)
         m_codeBlock->m_numCalleeRegisters = calleeRegisters;
 
@@ -71,13 +71,20 @@ void Graph::dump(NodeIndex nodeIndex, CodeBlock* codeBlock)
     //         id#  - the index in the CodeBlock of an identifier { if codeBlock is passed to dump(), the string representation is displayed }.
     //         var# - the index of a var on the global object, used by GetGlobalVar/PutGlobalVar operations.
     printf("% 4d:\t<%c%u:%u>\t%s(", (int)nodeIndex, mustGenerate ? '!' : ' ', refCount, node.virtualRegister, dfgOpNames[op & NodeIdMask]);
-    if (node.child1 != NoNode)
-        printf("@%u", node.child1);
-    if (node.child2 != NoNode)
-        printf(", @%u", node.child2);
-    if (node.child3 != NoNode)
-        printf(", @%u", node.child3);
-    bool hasPrinted = node.child1 != NoNode;
+    bool hasPrinted;
+    if (node.hasVarArgs()) {
+        for (unsigned i = 0; i < node.numChildren(); ++i)
+            printf("%s@%u", i ? ", " : "", m_varArgChildren[node.firstChild() + i]);
+        hasPrinted = node.numChildren();
+    } else {
+        if (node.child1 != NoNode)
+            printf("@%u", node.child1);
+        if (node.child2 != NoNode)
+            printf(", @%u", node.child2);
+        if (node.child3 != NoNode)
+            printf(", @%u", node.child3);
+        hasPrinted = node.child1 != NoNode;
+    }
 
     if (node.hasVarNumber()) {
         printf("%svar%u", hasPrinted ? ", " : "", node.varNumber());
@@ -125,8 +132,8 @@ void Graph::dump(NodeIndex nodeIndex, CodeBlock* codeBlock)
 void Graph::dump(CodeBlock* codeBlock)
 {
     for (size_t b = 0; b < m_blocks.size(); ++b) {
-        printf("Block #%u:\n", (int)b);
         BasicBlock& block = m_blocks[b];
+        printf("Block #%u%s:\n", (int)b, block.isLoopHeader ? " (loop header)" : "");
         for (size_t i = block.begin; i < block.end; ++i)
             dump(i, codeBlock);
     }
@@ -139,6 +146,12 @@ void Graph::refChildren(NodeIndex op)
 {
     Node& node = at(op);
 
+    if (node.hasVarArgs()) {
+        for (unsigned i = 0; i < node.numChildren(); ++i)
+            ref(m_varArgChildren[node.firstChild() + i]);
+        return;
+    }
+
     if (node.child1 == NoNode) {
         ASSERT(node.child2 == NoNode && node.child3 == NoNode);
         return;
@@ -159,6 +172,12 @@ void Graph::derefChildren(NodeIndex op)
 {
     Node& node = at(op);
 
+    if (node.hasVarArgs()) {
+        for (unsigned i = 0; i < node.numChildren(); ++i)
+            deref(m_varArgChildren[node.firstChild() + i]);
+        return;
+    }
+
     if (node.child1 == NoNode) {
         ASSERT(node.child2 == NoNode && node.child3 == NoNode);
         return;
@@ -45,6 +45,7 @@ struct BasicBlock {
         : bytecodeBegin(bytecodeBegin)
         , begin(begin)
         , end(end)
+        , isLoopHeader(false)
     {
     }
 
@@ -56,6 +57,9 @@ struct BasicBlock {
     unsigned bytecodeBegin;
     NodeIndex begin;
     NodeIndex end;
+    // Set if this block is the target of a backwards branch; such blocks
+    // are the points at which execution may enter from the baseline JIT.
+    bool isLoopHeader;
 };
 
 // 
@@ -66,6 +70,11 @@ struct BasicBlock {
 // Nodes that are 'dead' remain in the vector with refCount 0.
 class Graph : public Vector<Node, 64> {
 public:
+    Graph()
+        : m_parameterSlots(0)
+    {
+    }
+
     // Mark a node as being referenced.
     void ref(NodeIndex nodeIndex)
     {
@@ -90,6 +99,11 @@ public:
 #endif
 
     Vector<BasicBlock> m_blocks;
+    // The children of nodes with variable numbers of arguments (see NodeHasVarArgs).
+    Vector<NodeIndex, 16> m_varArgChildren;
+    // The number of registers reserved at the top of the call frame for outgoing
+    // call frames and argument buffers (see JITCodeGenerator::emitCall).
+    unsigned m_parameterSlots;
 
     BlockIndex blockIndexForBytecodeOffset(unsigned bytecodeBegin)
     {
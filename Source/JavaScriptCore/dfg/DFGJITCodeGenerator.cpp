@@ -30,6 +30,8 @@
 
 #include "DFGNonSpeculativeJIT.h"
 #include "DFGSpeculativeJIT.h"
+#include "JITStubs.h"
+#include "JSGlobalData.h"
 #include "LinkBuffer.h"
 
 namespace JSC { namespace DFG {
@@ -314,6 +316,12 @@ GPRReg JITCodeGenerator::fillJSValue(NodeIndex nodeIndex)
 
 void JITCodeGenerator::useChildren(Node& node)
 {
+    if (node.hasVarArgs()) {
+        for (unsigned child = node.firstChild(); child < node.firstChild() + node.numChildren(); ++child)
+            use(m_jit.graph().m_varArgChildren[child]);
+        return;
+    }
+
     NodeIndex child1 = node.child1;
     if (child1 == NoNode) {
         ASSERT(node.child2 == NoNode && node.child3 == NoNode);
@@ -334,6 +342,120 @@ void JITCodeGenerator::useChildren(Node& node)
     use(child3);
 }
 
+void JITCodeGenerator::emitCall(Node& node)
+{
+    ASSERT(node.op == Call || node.op == Construct);
+    bool isCall = node.op == Call;
+    Vector<NodeIndex, 16>& children = m_jit.graph().m_varArgChildren;
+
+    // The callee's call frame is placed in the registers reserved at the top of this
+    // function's frame (see Graph::m_parameterSlots), preceded by its arguments.
+    unsigned argCount = node.numChildren() - 1;
+    int registerOffset = m_jit.codeBlock()->m_numCalleeRegisters - m_jit.graph().m_parameterSlots + argCount + RegisterFile::CallFrameHeaderSize;
+    int firstArgument = registerOffset - RegisterFile::CallFrameHeaderSize - argCount;
+    unsigned exceptionInfo = m_jit.graph()[m_compileIndex].exceptionInfo;
+
+    // Flush all values to the RegisterFile, so that they can be copied into
+    // the arguments, and are preserved across the call.
+    flushRegisters();
+    GPRResult result(this);
+    GPRTemporary temp(this);
+    JITCompiler::RegisterID resultReg = result.registerID();
+    JITCompiler::RegisterID tempReg = temp.registerID();
+
+    for (unsigned argument = 0; argument < argCount; ++argument) {
+        m_jit.fillToJS(children[node.firstChild() + 1 + argument], temp.gpr());
+        m_jit.storePtr(tempReg, JITCompiler::Address(JITCompiler::callFrameRegister, (firstArgument + argument) * static_cast<int>(sizeof(Register))));
+    }
+
+    // This matches the old JIT's unoptimized call; the callee is passed in regT0.
+    ASSERT(resultReg == JITCompiler::regT0);
+    m_jit.fillToJS(children[node.firstChild()], result.gpr());
+
+    // Check for JSFunctions.
+    JITCompiler::Jump notCell = m_jit.branchTestPtr(JITCompiler::NonZero, resultReg, JITCompiler::tagMaskRegister);
+    JITCompiler::Jump notFunction = m_jit.branchPtr(JITCompiler::NotEqual, JITCompiler::Address(resultReg), JITCompiler::TrustedImmPtr(m_jit.globalData()->jsFunctionVPtr));
+
+    // Roll the callframe, and call through the virtual call trampoline; the callee
+    // restores the callFrameRegister on return.
+    m_jit.storePtr(JITCompiler::callFrameRegister, JITCompiler::Address(JITCompiler::callFrameRegister, (RegisterFile::CallerFrame + registerOffset) * static_cast<int>(sizeof(Register))));
+    m_jit.addPtr(Imm32(registerOffset * static_cast<int>(sizeof(Register))), JITCompiler::callFrameRegister);
+    m_jit.move(Imm32(argCount), JITCompiler::regT1);
+    JITThunks* jitStubs = m_jit.globalData()->jitStubs.get();
+    MacroAssemblerCodePtr virtualCall = isCall ? jitStubs->ctiVirtualCall() : jitStubs->ctiVirtualConstruct();
+    m_jit.appendCallWithExceptionInfo(FunctionPtr(virtualCall.executableAddress()), exceptionInfo);
+    JITCompiler::Jump done = m_jit.jump();
+
+    // Calls to anything other than a JSFunction go through a JIT stub; these may throw
+    // directly, so we do not need to plant an exception check.
+    notCell.link(&m_jit);
+    notFunction.link(&m_jit);
+    m_jit.poke(resultReg, JITSTACKFRAME_ARGS_INDEX);
+    m_jit.poke(Imm32(registerOffset), JITSTACKFRAME_ARGS_INDEX + 1);
+    m_jit.poke(Imm32(argCount), JITSTACKFRAME_ARGS_INDEX + 2);
+    m_jit.move(JITCompiler::stackPointerRegister, JITCompiler::argumentRegister0);
+    m_jit.poke(JITCompiler::callFrameRegister, OBJECT_OFFSETOF(struct JITStackFrame, callFrame) / sizeof(void*));
+    m_jit.appendCallWithExceptionInfo(isCall ? cti_op_call_NotJSFunction : cti_op_construct_NotJSConstruct, exceptionInfo);
+
+    done.link(&m_jit);
+    jsValueResult(result.gpr(), m_compileIndex);
+}
+
+void JITCodeGenerator::emitNewArray(Node& node)
+{
+    Vector<NodeIndex, 16>& children = m_jit.graph().m_varArgChildren;
+
+    // The elements are copied into the registers reserved at the top of this
+    // function's frame (see Graph::m_parameterSlots), from where operationNewArray
+    // reads them.
+    unsigned numElements = node.numChildren();
+    int firstElement = m_jit.codeBlock()->m_numCalleeRegisters - m_jit.graph().m_parameterSlots;
+
+    flushRegisters();
+    GPRResult result(this);
+    GPRTemporary temp(this);
+    JITCompiler::RegisterID tempReg = temp.registerID();
+
+    for (unsigned element = 0; element < numElements; ++element) {
+        m_jit.fillToJS(children[node.firstChild() + element], temp.gpr());
+        m_jit.storePtr(tempReg, JITCompiler::Address(JITCompiler::callFrameRegister, (firstElement + element) * static_cast<int>(sizeof(Register))));
+    }
+    m_jit.addPtr(Imm32(firstElement * static_cast<int>(sizeof(Register))), JITCompiler::callFrameRegister, tempReg);
+
+    callOperation(operationNewArray, result.gpr(), temp.gpr(), numElements);
+    jsValueResult(result.gpr(), m_compileIndex);
+}
+
+void JITCodeGenerator::emitResolveGlobal(Node& node)
+{
+    GlobalResolveInfo* resolveInfo = &m_jit.codeBlock()->globalResolveInfo(node.resolveInfoIndex());
+
+    flushRegisters();
+    GPRResult result(this);
+    GPRTemporary temp(this);
+    JITCompiler::RegisterID resultReg = result.registerID();
+    JITCompiler::RegisterID tempReg = temp.registerID();
+
+    // Check Structure of global object, this matches the old JIT.
+    m_jit.move(JITCompiler::TrustedImmPtr(m_jit.codeBlock()->globalObject()), resultReg);
+    m_jit.loadPtr(&resolveInfo->structure, tempReg);
+    JITCompiler::Jump structuresMatch = m_jit.branchPtr(JITCompiler::Equal, tempReg, JITCompiler::Address(resultReg, JSCell::structureOffset()));
+
+    // Structures don't match; operationResolveGlobal will update the cached Structure & offset.
+    callOperation(operationResolveGlobal, result.gpr(), resolveInfo, identifier(node.identifierNumber()));
+    JITCompiler::Jump done = m_jit.jump();
+
+    // Load cached property.
+    // Assume that the global object always uses external storage.
+    structuresMatch.link(&m_jit);
+    m_jit.loadPtr(JITCompiler::Address(resultReg, JSObject::offsetOfPropertyStorage()), resultReg);
+    m_jit.load32(&resolveInfo->offset, tempReg);
+    m_jit.loadPtr(JITCompiler::BaseIndex(resultReg, tempReg, JITCompiler::ScalePtr), resultReg);
+
+    done.link(&m_jit);
+    jsValueResult(result.gpr(), m_compileIndex);
+}
+
 #ifndef NDEBUG
 static const char* dataFormatString(DataFormat format)
 {
@@ -145,6 +145,9 @@ public:
         return info.registerFormat() == DataFormatDouble;
     }
 
+    // The labels at the head of each basic block, used to generate entry points.
+    const Vector<MacroAssembler::Label>& blockHeads() { return m_blockHeads; }
+
 protected:
     JITCodeGenerator(JITCompiler& jit, bool isSpeculative)
         : m_jit(jit)
@@ -577,7 +580,43 @@ protected:
             m_jit.swap(JITCompiler::argumentRegister2, JITCompiler::argumentRegister3);
     }
 
+    // These methods generate code for nodes common to both code generators.
+    void emitCall(Node&);
+    void emitNewArray(Node&);
+    void emitResolveGlobal(Node&);
+
     // These methods add calls to C++ helper functions.
+    void callOperation(J_DFGOperation_E operation, GPRReg result)
+    {
+        ASSERT(isFlushed());
+
+        m_jit.move(JITCompiler::callFrameRegister, JITCompiler::argumentRegister0);
+
+        appendCallWithExceptionCheck(operation);
+        m_jit.move(JITCompiler::returnValueRegister, JITCompiler::gprToRegisterID(result));
+    }
+    void callOperation(J_DFGOperation_EPI operation, GPRReg result, void* pointer, Identifier* identifier)
+    {
+        ASSERT(isFlushed());
+
+        m_jit.move(JITCompiler::TrustedImmPtr(pointer), JITCompiler::argumentRegister1);
+        m_jit.move(JITCompiler::TrustedImmPtr(identifier), JITCompiler::argumentRegister2);
+        m_jit.move(JITCompiler::callFrameRegister, JITCompiler::argumentRegister0);
+
+        appendCallWithExceptionCheck(operation);
+        m_jit.move(JITCompiler::returnValueRegister, JITCompiler::gprToRegisterID(result));
+    }
+    void callOperation(J_DFGOperation_EPS operation, GPRReg result, GPRReg arg1, size_t size)
+    {
+        ASSERT(isFlushed());
+
+        m_jit.move(JITCompiler::gprToRegisterID(arg1), JITCompiler::argumentRegister1);
+        m_jit.move(JITCompiler::TrustedImmPtr(reinterpret_cast<void*>(size)), JITCompiler::argumentRegister2);
+        m_jit.move(JITCompiler::callFrameRegister, JITCompiler::argumentRegister0);
+
+        appendCallWithExceptionCheck(operation);
+        m_jit.move(JITCompiler::returnValueRegister, JITCompiler::gprToRegisterID(result));
+    }
     void callOperation(J_DFGOperation_EJP operation, GPRReg result, GPRReg arg1, void* pointer)
     {
         ASSERT(isFlushed());
@@ -34,6 +34,7 @@
 #include "DFGOperations.h"
 #include "DFGRegisterBank.h"
 #include "DFGSpeculativeJIT.h"
+#include "JSArray.h"
 #include "JSGlobalData.h"
 #include "LinkBuffer.h"
 
@@ -217,38 +218,8 @@ void JITCompiler::linkSpeculationChecks(SpeculativeJIT& speculative, NonSpeculat
     ASSERT(!(entriesIter != entriesEnd));
 }
 
-void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWithArityCheck)
+void JITCompiler::compileBody()
 {
-    // === Stage 1 - Function header code generation ===
-    //
-    // This code currently matches the old JIT. In the function header we need to
-    // pop the return address (since we do not allow any recursion on the machine
-    // stack), and perform a fast register file check.
-
-    // This is the main entry point, without performing an arity check.
-    // FIXME: https://bugs.webkit.org/show_bug.cgi?id=56292
-    // We'll need to convert the remaining cti_ style calls (specifically the register file
-    // check) which will be dependent on stack layout. (We'd need to account for this in
-    // both normal return code and when jumping to an exception handler).
-    preserveReturnAddressAfterCall(regT2);
-    emitPutToCallFrameHeader(regT2, RegisterFile::ReturnPC);
-    // If we needed to perform an arity check we will already have moved the return address,
-    // so enter after this.
-    Label fromArityCheck(this);
-
-    // Setup a pointer to the codeblock in the CallFrameHeader.
-    emitPutImmediateToCallFrameHeader(m_codeBlock, RegisterFile::CodeBlock);
-
-    // Plant a check that sufficient space is available in the RegisterFile.
-    // FIXME: https://bugs.webkit.org/show_bug.cgi?id=56291
-    addPtr(Imm32(m_codeBlock->m_numCalleeRegisters * sizeof(Register)), callFrameRegister, regT1);
-    Jump registerFileCheck = branchPtr(Below, AbsoluteAddress(m_globalData->interpreter->registerFile().addressOfEnd()), regT1);
-    // Return here after register file check.
-    Label fromRegisterFileCheck = label();
-
-
-    // === Stage 2 - Function body code generation ===
-    //
     // We generate the speculative code path, followed by the non-speculative
     // code for the function. Next we need to link the two together, making
     // bail-outs from the speculative path jump to the corresponding point on
@@ -270,6 +241,8 @@ void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWi
     // to allow it to check which nodes in the graph may bail out, and may need to reenter the
     // non-speculative path.
     if (compiledSpeculative) {
+        m_blockHeads = speculative.blockHeads();
+
         SpeculationCheckIndexIterator checkIterator(speculative.speculationChecks());
         NonSpeculativeJIT nonSpeculative(*this);
         nonSpeculative.compile(checkIterator);
@@ -285,14 +258,13 @@ void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWi
         SpeculationCheckIndexIterator checkIterator(noChecks);
         NonSpeculativeJIT nonSpeculative(*this);
         nonSpeculative.compile(checkIterator);
-    }
 
-    // === Stage 3 - Function footer code generation ===
-    //
-    // Generate code to lookup and jump to exception handlers, to perform the slow
-    // register file check (if the fast one in the function header fails), and
-    // generate the entry point with arity check.
+        m_blockHeads = nonSpeculative.blockHeads();
+    }
+}
 
+void JITCompiler::compileExceptionHandlers()
+{
     // Iterate over the m_calls vector, checking for exception checks,
     // and linking them to here.
     unsigned exceptionCheckCount = 0;
@@ -317,6 +289,68 @@ void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWi
         // and the address of the handler in returnValueRegister2.
         jump(returnValueRegister2);
     }
+}
+
+void JITCompiler::link(LinkBuffer& linkBuffer, Vector<CallReturnOffsetToBytecodeOffset>& callReturnIndexVector)
+{
+#if DFG_DEBUG_VERBOSE
+    fprintf(stderr, "JIT code start at %p\n", linkBuffer.debugAddress());
+#endif
+
+    // Link all calls out from the JIT code to their respective functions.
+    for (unsigned i = 0; i < m_calls.size(); ++i)
+        linkBuffer.link(m_calls[i].m_call, m_calls[i].m_function);
+
+    if (m_codeBlock->needsCallReturnIndices()) {
+        for (unsigned i = 0; i < m_calls.size(); ++i) {
+            if (m_calls[i].m_hasExceptionInfo) {
+                unsigned returnAddressOffset = linkBuffer.returnAddressOffset(m_calls[i].m_call);
+                unsigned exceptionInfo = m_calls[i].m_exceptionInfo;
+                callReturnIndexVector.append(CallReturnOffsetToBytecodeOffset(returnAddressOffset, exceptionInfo));
+            }
+        }
+    }
+}
+
+void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWithArityCheck)
+{
+    // === Stage 1 - Function header code generation ===
+    //
+    // This code currently matches the old JIT. In the function header we need to
+    // pop the return address (since we do not allow any recursion on the machine
+    // stack), and perform a fast register file check.
+
+    // This is the main entry point, without performing an arity check.
+    // FIXME: https://bugs.webkit.org/show_bug.cgi?id=56292
+    // We'll need to convert the remaining cti_ style calls (specifically the register file
+    // check) which will be dependent on stack layout. (We'd need to account for this in
+    // both normal return code and when jumping to an exception handler).
+    preserveReturnAddressAfterCall(regT2);
+    emitPutToCallFrameHeader(regT2, RegisterFile::ReturnPC);
+    // If we needed to perform an arity check we will already have moved the return address,
+    // so enter after this.
+    Label fromArityCheck(this);
+
+    // Setup a pointer to the codeblock in the CallFrameHeader.
+    emitPutImmediateToCallFrameHeader(m_codeBlock, RegisterFile::CodeBlock);
+
+    // Plant a check that sufficient space is available in the RegisterFile.
+    // FIXME: https://bugs.webkit.org/show_bug.cgi?id=56291
+    addPtr(Imm32(m_codeBlock->m_numCalleeRegisters * sizeof(Register)), callFrameRegister, regT1);
+    Jump registerFileCheck = branchPtr(Below, AbsoluteAddress(m_globalData->interpreter->registerFile().addressOfEnd()), regT1);
+    // Return here after register file check.
+    Label fromRegisterFileCheck = label();
+
+
+    // === Stage 2 - Function body code generation ===
+    compileBody();
+
+    // === Stage 3 - Function footer code generation ===
+    //
+    // Generate code to lookup and jump to exception handlers, to perform the slow
+    // register file check (if the fast one in the function header fails), and
+    // generate the entry point with arity check.
+    compileExceptionHandlers();
 
     // Generate the register file check; if the fast check in the function head fails,
     // we need to call out to a helper function to check whether more space is available.
@@ -348,25 +382,7 @@ void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWi
     // Link the code, populate data in CodeBlock data structures.
 
     LinkBuffer linkBuffer(this, m_globalData->executableAllocator.poolForSize(m_assembler.size()), 0);
-
-#if DFG_DEBUG_VERBOSE
-    fprintf(stderr, "JIT code start at %p\n", linkBuffer.debugAddress());
-#endif
-
-    // Link all calls out from the JIT code to their respective functions.
-    for (unsigned i = 0; i < m_calls.size(); ++i)
-        linkBuffer.link(m_calls[i].m_call, m_calls[i].m_function);
-
-    if (m_codeBlock->needsCallReturnIndices()) {
-        m_codeBlock->callReturnIndexVector().reserveCapacity(exceptionCheckCount);
-        for (unsigned i = 0; i < m_calls.size(); ++i) {
-            if (m_calls[i].m_exceptionCheck.isSet()) {
-                unsigned returnAddressOffset = linkBuffer.returnAddressOffset(m_calls[i].m_call);
-                unsigned exceptionInfo = m_calls[i].m_exceptionInfo;
-                m_codeBlock->callReturnIndexVector().append(CallReturnOffsetToBytecodeOffset(returnAddressOffset, exceptionInfo));
-            }
-        }
-    }
+    link(linkBuffer, m_codeBlock->callReturnIndexVector());
 
     // FIXME: switch the register file check & arity check over to DFGOpertaion style calls, not JIT stubs.
     linkBuffer.link(callRegisterFileCheck, cti_register_file_check);
@@ -376,6 +392,39 @@ void JITCompiler::compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWi
     entry = linkBuffer.finalizeCode();
 }
 
+void JITCompiler::compileForLoopEntry(JITCode& code, Vector<OptimizedLoopEntry>& loopEntries, Vector<CallReturnOffsetToBytecodeOffset>& callReturnIndexVector)
+{
+    // The code is entered from code generated by the old JIT, at the head of a loop;
+    // the call frame has already been set up, and all values are in the RegisterFile
+    // (the caller is responsible for ensuring the RegisterFile is large enough).
+    // There is no function header; the first block is never executed.
+    compileBody();
+    compileExceptionHandlers();
+
+    LinkBuffer linkBuffer(this, m_globalData->executableAllocator.poolForSize(m_assembler.size()), 0);
+    link(linkBuffer, callReturnIndexVector);
+
+    Vector<BasicBlock>& blocks = m_graph.m_blocks;
+    for (BlockIndex block = 0; block < blocks.size(); ++block) {
+        if (blocks[block].isLoopHeader)
+            loopEntries.append(OptimizedLoopEntry(blocks[block].bytecodeBegin, linkBuffer.locationOf(m_blockHeads[block])));
+    }
+
+    code = linkBuffer.finalizeCode();
+}
+
+void JITCompiler::emitTimeoutCheck(unsigned exceptionInfo)
+{
+    // This matches the old JIT, timeoutCheckRegister counts down to the next call out
+    // to check the timeout; cti_timeout_check returns the next count, or throws.
+    Jump skipTimeoutCheck = branchSub32(NonZero, TrustedImm32(1), timeoutCheckRegister);
+    move(stackPointerRegister, argumentRegister0);
+    poke(callFrameRegister, OBJECT_OFFSETOF(struct JITStackFrame, callFrame) / sizeof(void*));
+    appendCallWithExceptionInfo(cti_timeout_check, exceptionInfo);
+    move(returnValueRegister, timeoutCheckRegister);
+    skipTimeoutCheck.link(this);
+}
+
 #if DFG_JIT_ASSERT
 void JITCompiler::jitAssertIsInt32(GPRReg gpr)
 {
@@ -412,6 +461,21 @@ void JITCompiler::jitAssertIsJSDouble(GPRReg gpr)
 }
 #endif
 
+void JITCompiler::emitUpdateArrayIndexingShape(RegisterID storage, RegisterID value)
+{
+    Address shape(storage, OBJECT_OFFSETOF(ArrayStorage, m_indexingShape));
+    Jump isContiguous = branch32(Equal, shape, TrustedImm32(ArrayWithContiguous));
+    Jump isInt32 = branchPtr(AboveOrEqual, value, tagTypeNumberRegister);
+    Jump isDouble = branchTestPtr(NonZero, value, tagTypeNumberRegister);
+    store32(TrustedImm32(ArrayWithContiguous), shape);
+    Jump done = jump();
+    isDouble.link(this);
+    store32(TrustedImm32(ArrayWithDouble), shape);
+    isContiguous.link(this);
+    isInt32.link(this);
+    done.link(this);
+}
+
 #if ENABLE(SAMPLING_COUNTERS) && CPU(X86_64) // Or any other 64-bit platform!
 void JITCompiler::emitCount(AbstractSamplingCounter& counter, uint32_t increment)
 {
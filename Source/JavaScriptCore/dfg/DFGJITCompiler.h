@@ -38,6 +38,7 @@ namespace JSC {
 class AbstractSamplingCounter;
 class CodeBlock;
 class JSGlobalData;
+class LinkBuffer;
 
 namespace DFG {
 
@@ -78,6 +79,7 @@ struct CallRecord {
     CallRecord(MacroAssembler::Call call, FunctionPtr function)
         : m_call(call)
         , m_function(function)
+        , m_hasExceptionInfo(false)
     {
     }
 
@@ -87,6 +89,17 @@ struct CallRecord {
         , m_function(function)
         , m_exceptionCheck(exceptionCheck)
         , m_exceptionInfo(exceptionInfo)
+        , m_hasExceptionInfo(true)
+    {
+    }
+
+    // Constructor for a call that may throw, but where the exception is thrown by
+    // unwinding from the callee (calls to JS functions, and to JIT stubs).
+    CallRecord(MacroAssembler::Call call, FunctionPtr function, ExceptionInfo exceptionInfo)
+        : m_call(call)
+        , m_function(function)
+        , m_exceptionInfo(exceptionInfo)
+        , m_hasExceptionInfo(true)
     {
     }
 
@@ -94,6 +107,7 @@ struct CallRecord {
     FunctionPtr m_function;
     MacroAssembler::Jump m_exceptionCheck;
     ExceptionInfo m_exceptionInfo;
+    bool m_hasExceptionInfo;
 };
 
 // === JITCompiler ===
@@ -114,6 +128,8 @@ public:
     }
 
     void compileFunction(JITCode& entry, MacroAssemblerCodePtr& entryWithArityCheck);
+    // Compile code to be entered at the heads of loops, from code generated by the old JIT.
+    void compileForLoopEntry(JITCode&, Vector<OptimizedLoopEntry>&, Vector<CallReturnOffsetToBytecodeOffset>&);
 
     // Accessors for properties.
     Graph& graph() { return m_graph; }
@@ -247,6 +263,16 @@ public:
         m_calls.append(CallRecord(functionCall, function, exceptionCheck, exceptionInfo));
     }
 
+    // Add a call out from JIT code to a JS function or JIT stub, which will throw any
+    // exception itself, but needs to be able to map its return address back to bytecode.
+    void appendCallWithExceptionInfo(const FunctionPtr& function, unsigned exceptionInfo)
+    {
+        m_calls.append(CallRecord(call(), function, exceptionInfo));
+    }
+
+    // Plant a check of the timeout counter (as at the head of loops in the old JIT).
+    void emitTimeoutCheck(unsigned exceptionInfo);
+
     // Helper methods to check nodes for constants.
     bool isConstant(NodeIndex nodeIndex)
     {
@@ -296,16 +322,27 @@ public:
     void jitAssertIsJSDouble(GPRReg) {}
 #endif
 
+    // This method is used to fill a JSValue to a GPR, where the value has been flushed to the RegisterFile.
+    void fillToJS(NodeIndex, GPRReg);
+
+    // Widen the indexing shape of a JSArray's 'storage' to admit 'value' (see JSArray.h).
+    void emitUpdateArrayIndexingShape(RegisterID storage, RegisterID value);
+
 #if ENABLE(SAMPLING_COUNTERS)
     // Debug profiling tool.
     void emitCount(AbstractSamplingCounter&, uint32_t increment = 1);
 #endif
 
 private:
+    // Generate the body of the function, and the code to handle exceptions thrown from it.
+    void compileBody();
+    void compileExceptionHandlers();
+    // Link the calls out from the JIT code, and record their return addresses.
+    void link(LinkBuffer&, Vector<CallReturnOffsetToBytecodeOffset>&);
+
     // These methods used in linking the speculative & non-speculative paths together.
     void fillNumericToDouble(NodeIndex, FPRReg, GPRReg temporary);
     void fillInt32ToInteger(NodeIndex, GPRReg);
-    void fillToJS(NodeIndex, GPRReg);
     void jumpFromSpeculativeToNonSpeculative(const SpeculationCheck&, const EntryLocation&, SpeculationRecovery*);
     void linkSpeculationChecks(SpeculativeJIT&, NonSpeculativeJIT&);
 
@@ -320,6 +357,10 @@ private:
 
     // Vector of calls out from JIT code, including exception handler information.
     Vector<CallRecord> m_calls;
+
+    // The heads of each basic block, in the code path that is entered at the start of
+    // the function (the speculative path, if this was successfully generated).
+    Vector<Label> m_blockHeads;
 };
 
 } } // namespace JSC::DFG
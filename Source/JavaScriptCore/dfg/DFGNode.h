@@ -71,6 +71,7 @@ typedef uint32_t ExceptionInfo;
 #define NodeIsConstant    0x20000
 #define NodeIsJump        0x40000
 #define NodeIsBranch      0x80000
+#define NodeHasVarArgs   0x100000 // children are a range in Graph::m_varArgChildren, rather than child1..child3.
 
 // These values record the result type of the node (as checked by NodeResultMask, above), 0 for no result.
 #define NodeResultJS      0x1000
@@ -127,6 +128,15 @@ typedef uint32_t ExceptionInfo;
     macro(PutByIdDirect, NodeMustGenerate) \
     macro(GetGlobalVar, NodeResultJS | NodeMustGenerate) \
     macro(PutGlobalVar, NodeMustGenerate) \
+    macro(ResolveGlobal, NodeResultJS | NodeMustGenerate) \
+    \
+    /* Object & array allocation. */\
+    macro(NewObject, NodeResultJS) \
+    macro(NewArray, NodeResultJS | NodeHasVarArgs) \
+    \
+    /* Calls. The first child is the callee, the second the 'this' value, followed by the arguments. */\
+    macro(Call, NodeResultJS | NodeMustGenerate | NodeHasVarArgs) \
+    macro(Construct, NodeResultJS | NodeMustGenerate | NodeHasVarArgs) \
     \
     /* Nodes for comparison operations. */\
     macro(CompareLess, NodeResultJS | NodeMustGenerate) \
@@ -238,7 +248,7 @@ struct Node {
 
     bool hasIdentifier()
     {
-        return op == GetById || op == PutById || op == PutByIdDirect;
+        return op == GetById || op == PutById || op == PutByIdDirect || op == ResolveGlobal;
     }
 
     unsigned identifierNumber()
@@ -258,6 +268,12 @@ struct Node {
         return m_opInfo;
     }
 
+    unsigned resolveInfoIndex()
+    {
+        ASSERT(op == ResolveGlobal);
+        return m_constantValue.opInfo2;
+    }
+
     bool hasInt32Result()
     {
         return (op & NodeResultMask) == NodeResultInt32;
@@ -305,6 +321,25 @@ struct Node {
         m_constantValue.asDouble = value;
     }
 
+    bool hasVarArgs()
+    {
+        return op & NodeHasVarArgs;
+    }
+
+    // For nodes with variable numbers of children, child1 & child2 are used
+    // to record the range of the children in Graph::m_varArgChildren.
+    unsigned firstChild()
+    {
+        ASSERT(hasVarArgs());
+        return child1;
+    }
+
+    unsigned numChildren()
+    {
+        ASSERT(hasVarArgs());
+        return child2;
+    }
+
     bool isJump()
     {
         return op & NodeIsJump;
@@ -331,7 +366,7 @@ struct Node {
     NodeType op;
     // Used to look up exception handling information (currently implemented as a bytecode index).
     ExceptionInfo exceptionInfo;
-    // References to up to 3 children (0 for no child).
+    // References to up to 3 children (0 for no child), or for NodeHasVarArgs nodes the range of children in the Graph.
     NodeIndex child1, child2, child3;
     // The virtual register number (spill location) associated with this .
     VirtualRegister virtualRegister;
@@ -590,6 +590,27 @@ void NonSpeculativeJIT::compile(SpeculationCheckIndexIterator& checkIterator, No
         break;
     }
 
+    case NewObject: {
+        flushRegisters();
+        GPRResult result(this);
+        callOperation(operationNewObject, result.gpr());
+        jsValueResult(result.gpr(), m_compileIndex);
+        break;
+    }
+
+    case NewArray:
+        emitNewArray(node);
+        break;
+
+    case ResolveGlobal:
+        emitResolveGlobal(node);
+        break;
+
+    case Call:
+    case Construct:
+        emitCall(node);
+        break;
+
     case DFG::Jump: {
         BlockIndex taken = m_jit.graph().blockIndexForBytecodeOffset(node.takenBytecodeOffset());
         if (taken != (m_block + 1))
@@ -654,6 +675,9 @@ void NonSpeculativeJIT::compile(SpeculationCheckIndexIterator& checkIterator, Ba
 {
     ASSERT(m_compileIndex == block.begin);
     m_blockHeads[m_block] = m_jit.label();
+    // Loops check for timeout on each iteration, in the same way as the old JIT.
+    if (block.isLoopHeader)
+        m_jit.emitTimeoutCheck(block.bytecodeBegin);
 
 #if DFG_JIT_BREAK_ON_EVERY_BLOCK
     m_jit.breakpoint();
@@ -29,7 +29,10 @@
 #if ENABLE(DFG_JIT)
 
 #include "CodeBlock.h"
+#include "Error.h"
+#include "ExceptionHelpers.h"
 #include "Interpreter.h"
+#include "JSArray.h"
 #include "JSByteArray.h"
 #include "JSGlobalData.h"
 #include "Operations.h"
@@ -108,6 +111,41 @@ EncodedJSValue operationGetById(ExecState* exec, EncodedJSValue encodedBase, Ide
     return JSValue::encode(baseValue.get(exec, *identifier, slot));
 }
 
+EncodedJSValue operationResolveGlobal(ExecState* exec, void* globalResolveInfo, Identifier* identifier)
+{
+    CodeBlock* codeBlock = exec->codeBlock();
+    GlobalResolveInfo& resolveInfo = *static_cast<GlobalResolveInfo*>(globalResolveInfo);
+    JSGlobalObject* globalObject = codeBlock->globalObject();
+    Identifier& ident = *identifier;
+
+    if (globalObject->structure()->isUncacheableDictionary())
+        globalObject->flattenDictionaryObject(exec->globalData());
+
+    PropertySlot slot(globalObject);
+    if (globalObject->getPropertySlot(exec, ident, slot)) {
+        JSValue result = slot.getValue(exec, ident);
+        if (slot.isCacheableValue() && !globalObject->structure()->isUncacheableDictionary() && slot.slotBase() == globalObject) {
+            resolveInfo.structure.set(exec->globalData(), codeBlock->ownerExecutable(), globalObject->structure());
+            resolveInfo.offset = slot.cachedOffset();
+        }
+        return JSValue::encode(result);
+    }
+
+    throwError(exec, createUndefinedVariableError(exec, ident));
+    return JSValue::encode(JSValue());
+}
+
+EncodedJSValue operationNewObject(ExecState* exec)
+{
+    return JSValue::encode(constructEmptyObject(exec));
+}
+
+EncodedJSValue operationNewArray(ExecState* exec, void* start, size_t size)
+{
+    ArgList argList(static_cast<Register*>(start), size);
+    return JSValue::encode(constructArray(exec, argList));
+}
+
 template<bool strict>
 ALWAYS_INLINE static void operationPutByValInternal(ExecState* exec, EncodedJSValue encodedBase, EncodedJSValue encodedProperty, EncodedJSValue encodedValue)
 {
@@ -597,6 +597,8 @@ bool SpeculativeJIT::compile(Node& node)
         // Get the array storage.
         m_jit.loadPtr(MacroAssembler::Address(baseReg, JSArray::storageOffset()), storageReg);
 
+        m_jit.emitUpdateArrayIndexingShape(storageReg, valueReg);
+
         // Check if we're writing to a hole; if so increment m_numValuesInVector.
         MacroAssembler::Jump notHoleValue = m_jit.branchTestPtr(MacroAssembler::NonZero, MacroAssembler::BaseIndex(storageReg, propertyReg, MacroAssembler::ScalePtr, OBJECT_OFFSETOF(ArrayStorage, m_vector[0])));
         m_jit.add32(TrustedImm32(1), MacroAssembler::Address(storageReg, OBJECT_OFFSETOF(ArrayStorage, m_numValuesInVector)));
@@ -631,6 +633,8 @@ bool SpeculativeJIT::compile(Node& node)
         MacroAssembler::RegisterID propertyReg = property.registerID();
         MacroAssembler::RegisterID valueReg = value.registerID();
 
+        m_jit.emitUpdateArrayIndexingShape(storageReg, valueReg);
+
         // Store the value to the array.
         m_jit.storePtr(valueReg, MacroAssembler::BaseIndex(storageReg, propertyReg, MacroAssembler::ScalePtr, OBJECT_OFFSETOF(ArrayStorage, m_vector[0])));
 
@@ -766,6 +770,27 @@ bool SpeculativeJIT::compile(Node& node)
         noResult(m_compileIndex);
         break;
     }
+
+    case NewObject: {
+        flushRegisters();
+        GPRResult result(this);
+        callOperation(operationNewObject, result.gpr());
+        jsValueResult(result.gpr(), m_compileIndex);
+        break;
+    }
+
+    case NewArray:
+        emitNewArray(node);
+        break;
+
+    case ResolveGlobal:
+        emitResolveGlobal(node);
+        break;
+
+    case Call:
+    case Construct:
+        emitCall(node);
+        break;
     }
 
     // Check if generation for the speculative path has failed catastrophically. :-)
@@ -786,6 +811,9 @@ bool SpeculativeJIT::compile(BasicBlock& block)
 {
     ASSERT(m_compileIndex == block.begin);
     m_blockHeads[m_block] = m_jit.label();
+    // Loops check for timeout on each iteration, in the same way as the old JIT.
+    if (block.isLoopHeader)
+        m_jit.emitTimeoutCheck(block.bytecodeBegin);
 #if DFG_JIT_BREAK_ON_EVERY_BLOCK
     m_jit.breakpoint();
 #endif
@@ -396,6 +396,11 @@ void Heap::reset(SweepToggle sweepToggle)
 
     JAVASCRIPTCORE_GC_MARKED();
 
+#if ENABLE(JIT)
+    // The megamorphic property access caches hold unmarked Structure and object pointers.
+    m_globalData->jitStubs->clearMegamorphicAccessCaches();
+#endif
+
     m_markedSpace.reset();
     m_extraCost = 0;
 
@@ -172,6 +172,11 @@ NEVER_INLINE bool Interpreter::resolveGlobal(CallFrame* callFrame, Instruction*
         return true;
     }
 
+    // A delete leaves the global object an uncacheable dictionary; flatten it so
+    // that this and later resolves can be cached again.
+    if (globalObject->structure()->isUncacheableDictionary())
+        globalObject->flattenDictionaryObject(callFrame->globalData());
+
     Identifier& ident = codeBlock->identifier(property);
     PropertySlot slot(globalObject);
     if (globalObject->getPropertySlot(callFrame, ident, slot)) {
@@ -211,10 +216,10 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
     ASSERT(iter != end);
     bool checkTopLevel = codeBlock->codeType() == FunctionCode && codeBlock->needsFullScopeChain();
     ASSERT(skip || !checkTopLevel);
-    if (checkTopLevel && skip--) {
-        if (callFrame->uncheckedR(codeBlock->activationRegister()).jsValue())
-            ++iter;
-    }
+    // The function's own activation is checked like any other scope (it may
+    // have picked up properties from eval), unless it has not been created yet.
+    if (checkTopLevel && !callFrame->uncheckedR(codeBlock->activationRegister()).jsValue())
+        skip--;
     while (skip--) {
         JSObject* o = iter->get();
         if (o->hasCustomProperties()) {
@@ -247,6 +252,9 @@ NEVER_INLINE bool Interpreter::resolveGlobalDynamic(CallFrame* callFrame, Instru
         return true;
     }
 
+    if (globalObject->structure()->isUncacheableDictionary())
+        globalObject->flattenDictionaryObject(callFrame->globalData());
+
     Identifier& ident = codeBlock->identifier(property);
     PropertySlot slot(globalObject);
     if (globalObject->getPropertySlot(callFrame, ident, slot)) {
@@ -1471,6 +1479,8 @@ JSValue Interpreter::privateExecute(ExecutionFlag flag, RegisterFile* registerFi
             exceptionValue = jsNull(); \
             goto vm_throw; \
         } \
+        if (UNLIKELY(globalData->timeoutChecker.isSampling())) \
+            Profiler::profiler()->didSample(callFrame, vPC - codeBlock->instructions().begin()); \
         tickCount = globalData->timeoutChecker.ticksUntilNextCheck(); \
     }
     
@@ -3605,6 +3615,107 @@ skip_id_custom_self:
         vPC += OPCODE_LENGTH(op_loop_if_lesseq);
         NEXT_INSTRUCTION();
     }
+    DEFINE_OPCODE(op_mov_mov) {
+        /* mov_mov dst(r) src(r)
+
+           Performs this mov and the mov that follows it (see
+           BytecodeGenerator::fuseInstructionPairs).
+        */
+        int dst = vPC[1].u.operand;
+        int src = vPC[2].u.operand;
+        callFrame->uncheckedR(dst) = callFrame->r(src);
+
+        vPC += OPCODE_LENGTH(op_mov);
+        dst = vPC[1].u.operand;
+        src = vPC[2].u.operand;
+        callFrame->uncheckedR(dst) = callFrame->r(src);
+
+        vPC += OPCODE_LENGTH(op_mov);
+        NEXT_INSTRUCTION();
+    }
+    DEFINE_OPCODE(op_add_mov) {
+        /* add_mov dst(r) src1(r) src2(r)
+
+           Performs this add and the mov that follows it.
+        */
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        if (src1.isInt32() && src2.isInt32() && !(src1.asInt32() | (src2.asInt32() & 0xc0000000))) // no overflow
+            callFrame->uncheckedR(dst) = jsNumber(src1.asInt32() + src2.asInt32());
+        else {
+            JSValue result = jsAdd(callFrame, src1, src2);
+            CHECK_FOR_EXCEPTION();
+            callFrame->uncheckedR(dst) = result;
+        }
+
+        vPC += OPCODE_LENGTH(op_add);
+        callFrame->uncheckedR(vPC[1].u.operand) = callFrame->r(vPC[2].u.operand);
+
+        vPC += OPCODE_LENGTH(op_mov);
+        NEXT_INSTRUCTION();
+    }
+    DEFINE_OPCODE(op_bitand_jfalse) {
+        /* bitand_jfalse dst(r) src1(r) src2(r)
+
+           Performs this bitand and the following jfalse, which tests
+           register dst.
+        */
+        int dst = vPC[1].u.operand;
+        JSValue src1 = callFrame->r(vPC[2].u.operand).jsValue();
+        JSValue src2 = callFrame->r(vPC[3].u.operand).jsValue();
+        if (src1.isInt32() && src2.isInt32()) {
+            int32_t result = src1.asInt32() & src2.asInt32();
+            callFrame->uncheckedR(dst) = jsNumber(result);
+
+            vPC += OPCODE_LENGTH(op_bitand);
+            if (!result) {
+                vPC += vPC[2].u.operand;
+                NEXT_INSTRUCTION();
+            }
+            vPC += OPCODE_LENGTH(op_jfalse);
+            NEXT_INSTRUCTION();
+        }
+
+        JSValue result = jsNumber(src1.toInt32(callFrame) & src2.toInt32(callFrame));
+        CHECK_FOR_EXCEPTION();
+        callFrame->uncheckedR(dst) = result;
+
+        vPC += OPCODE_LENGTH(op_bitand);
+        NEXT_INSTRUCTION();
+    }
+    DEFINE_OPCODE(op_pre_inc_loop_if_less) {
+        /* pre_inc_loop_if_less srcDst(r)
+
+           Performs this pre_inc and, when its operands are both int32,
+           the loop_if_less that follows it.
+        */
+        int srcDst = vPC[1].u.operand;
+        JSValue v = callFrame->r(srcDst).jsValue();
+        if (v.isInt32() && v.asInt32() < INT_MAX) {
+            callFrame->uncheckedR(srcDst) = jsNumber(v.asInt32() + 1);
+
+            vPC += OPCODE_LENGTH(op_pre_inc);
+            JSValue src1 = callFrame->r(vPC[1].u.operand).jsValue();
+            JSValue src2 = callFrame->r(vPC[2].u.operand).jsValue();
+            if (src1.isInt32() && src2.isInt32()) {
+                if (src1.asInt32() < src2.asInt32()) {
+                    vPC += vPC[3].u.operand;
+                    CHECK_FOR_TIMEOUT();
+                    NEXT_INSTRUCTION();
+                }
+                vPC += OPCODE_LENGTH(op_loop_if_less);
+            }
+            NEXT_INSTRUCTION();
+        }
+
+        JSValue result = jsNumber(v.toNumber(callFrame) + 1);
+        CHECK_FOR_EXCEPTION();
+        callFrame->uncheckedR(srcDst) = result;
+
+        vPC += OPCODE_LENGTH(op_pre_inc);
+        NEXT_INSTRUCTION();
+    }
     DEFINE_OPCODE(op_jnless) {
         /* jnless src1(r) src2(r) target(offset)
 
@@ -4213,6 +4324,10 @@ skip_id_custom_self:
            This opcode appears only at the beginning of a code block.
         */
 
+        // Code with no loops would otherwise never be seen by the sampling profiler.
+        if (UNLIKELY(globalData->timeoutChecker.isSampling()))
+            CHECK_FOR_TIMEOUT();
+
         size_t i = 0;
         for (size_t count = codeBlock->m_numVars; i < count; ++i)
             callFrame->uncheckedR(i) = jsUndefined();
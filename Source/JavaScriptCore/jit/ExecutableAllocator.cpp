@@ -51,10 +51,7 @@ void ExecutableAllocator::intializePageSize()
 
 ExecutablePool::Allocation ExecutablePool::systemAlloc(size_t size)
 {
-    PageAllocation allocation = PageAllocation::allocate(size, OSAllocator::JSJITCodePages, EXECUTABLE_POOL_WRITABLE, true);
-    if (!allocation)
-        CRASH();
-    return allocation;
+    return PageAllocation::allocate(size, OSAllocator::JSJITCodePages, EXECUTABLE_POOL_WRITABLE, true);
 }
 
 void ExecutablePool::systemRelease(ExecutablePool::Allocation& allocation)
@@ -77,6 +74,16 @@ size_t ExecutableAllocator::committedByteCount()
     return 0;
 } 
 
+size_t ExecutableAllocator::peakCommittedByteCount()
+{
+    return 0;
+}
+
+size_t ExecutableAllocator::failedAllocationCount()
+{
+    return 0;
+}
+
 #endif
 
 #if ENABLE(ASSEMBLER_WX_EXCLUSIVE)
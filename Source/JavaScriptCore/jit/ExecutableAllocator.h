@@ -109,8 +109,8 @@ public:
             , m_size(size)
         {
         }
-        void* base() { return m_base; }
-        size_t size() { return m_size; }
+        void* base() const { return m_base; }
+        size_t size() const { return m_size; }
         bool operator!() const { return !m_base; }
 
     private:
@@ -122,9 +122,15 @@ public:
 
     static PassRefPtr<ExecutablePool> create(size_t n)
     {
-        return adoptRef(new ExecutablePool(n));
+        RefPtr<ExecutablePool> pool = tryCreate(n);
+        if (!pool)
+            CRASH(); // Failed to allocate
+        return pool.release();
     }
 
+    // Returns 0 if the executable memory is exhausted.
+    static PassRefPtr<ExecutablePool> tryCreate(size_t n);
+
     void* alloc(size_t n)
     {
         ASSERT(m_freePtr <= m_end);
@@ -164,7 +170,7 @@ private:
     static Allocation systemAlloc(size_t n);
     static void systemRelease(Allocation& alloc);
 
-    ExecutablePool(size_t n);
+    ExecutablePool(const Allocation&);
 
     void* poolAllocate(size_t n);
 
@@ -195,6 +201,16 @@ public:
     static bool underMemoryPressure();
 
     PassRefPtr<ExecutablePool> poolForSize(size_t n)
+    {
+        RefPtr<ExecutablePool> pool = tryPoolForSize(n);
+        if (!pool)
+            CRASH(); // Failed to allocate
+        return pool.release();
+    }
+
+    // Clients that can fall back to another execution mode (e.g. the regular
+    // expression interpreter) should use this, and handle a null result.
+    PassRefPtr<ExecutablePool> tryPoolForSize(size_t n)
     {
         // Try to fit in the existing small allocator
         ASSERT(m_smallAllocationPool);
@@ -203,10 +219,12 @@ public:
 
         // If the request is large, we just provide a unshared allocator
         if (n > JIT_ALLOCATOR_LARGE_ALLOC_SIZE)
-            return ExecutablePool::create(n);
+            return ExecutablePool::tryCreate(n);
 
         // Create a new allocator
-        RefPtr<ExecutablePool> pool = ExecutablePool::create(JIT_ALLOCATOR_LARGE_ALLOC_SIZE);
+        RefPtr<ExecutablePool> pool = ExecutablePool::tryCreate(JIT_ALLOCATOR_LARGE_ALLOC_SIZE);
+        if (!pool)
+            return 0;
 
         // If the new allocator will result in more free space than in
         // the current small allocator, then we will use it instead
@@ -330,6 +348,8 @@ public:
     #error "The cacheFlush support is missing on this platform."
 #endif
     static size_t committedByteCount();
+    static size_t peakCommittedByteCount();
+    static size_t failedAllocationCount();
 
 private:
 
@@ -341,15 +361,21 @@ private:
     static void intializePageSize();
 };
 
-inline ExecutablePool::ExecutablePool(size_t n)
+inline PassRefPtr<ExecutablePool> ExecutablePool::tryCreate(size_t n)
 {
     size_t allocSize = roundUpAllocationSize(n, JIT_ALLOCATOR_PAGE_SIZE);
     Allocation mem = systemAlloc(allocSize);
+    if (!mem.base())
+        return 0;
+    return adoptRef(new ExecutablePool(mem));
+}
+
+inline ExecutablePool::ExecutablePool(const Allocation& mem)
+{
+    ASSERT(mem.base());
     m_pools.append(mem);
-    m_freePtr = static_cast<char*>(mem.base());
-    if (!m_freePtr)
-        CRASH(); // Failed to allocate
-    m_end = m_freePtr + allocSize;
+    m_freePtr = static_cast<char*>(m_pools.last().base());
+    m_end = m_freePtr + m_pools.last().size();
 }
 
 inline void* ExecutablePool::poolAllocate(size_t n)
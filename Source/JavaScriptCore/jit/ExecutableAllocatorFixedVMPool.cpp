@@ -403,6 +403,8 @@ class FixedVMPoolAllocator
 {
 public:
     FixedVMPoolAllocator()
+        : m_peakCommitted(0)
+        , m_failedAllocations(0)
     {
         ASSERT(PageTables256KB::size() == 256 * 1024);
         ASSERT(PageTables16MB::size() == 16 * 1024 * 1024);
@@ -425,15 +427,19 @@ public:
 
         if (size >= FixedVMPoolPageTables::size())
             CRASH();
-        if (m_pages.isFull())
-            CRASH();
 
-        size_t offset = m_pages.allocate(sizeClass);
-        if (offset == notFound)
-            CRASH();
+        // Running out of space is reported to the caller, which may be able
+        // to fall back to interpreting rather than crashing.
+        size_t offset = m_pages.isFull() ? notFound : m_pages.allocate(sizeClass);
+        if (offset == notFound) {
+            ++m_failedAllocations;
+            return ExecutablePool::Allocation(0, 0);
+        }
 
         void* pointer = offsetToPointer(offset);
         m_reservation.commit(pointer, size);
+        if (m_reservation.committed() > m_peakCommitted)
+            m_peakCommitted = m_reservation.committed();
         return ExecutablePool::Allocation(pointer, size);
     }
 
@@ -455,6 +461,9 @@ public:
         return m_reservation.committed();
     }
 
+    size_t peakAllocated() const { return m_peakCommitted; }
+    size_t failedAllocations() const { return m_failedAllocations; }
+
     bool isValid() const
     {
         return !!m_reservation;
@@ -478,6 +487,8 @@ private:
 
     PageReservation m_reservation;
     FixedVMPoolPageTables m_pages;
+    size_t m_peakCommitted;
+    size_t m_failedAllocations;
 };
 
 
@@ -491,6 +502,18 @@ size_t ExecutableAllocator::committedByteCount()
     return allocator ? allocator->allocated() : 0;
 }   
 
+size_t ExecutableAllocator::peakCommittedByteCount()
+{
+    SpinLockHolder lockHolder(&spinlock);
+    return allocator ? allocator->peakAllocated() : 0;
+}
+
+size_t ExecutableAllocator::failedAllocationCount()
+{
+    SpinLockHolder lockHolder(&spinlock);
+    return allocator ? allocator->failedAllocations() : 0;
+}
+
 void ExecutableAllocator::intializePageSize()
 {
     ExecutableAllocator::pageSize = getpagesize();
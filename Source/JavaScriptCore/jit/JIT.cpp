@@ -111,6 +111,59 @@ void JIT::emitTimeoutCheck()
 }
 #endif
 
+#if ENABLE(DFG_JIT)
+void JIT::findLoopHeaders()
+{
+    // The DFG JIT only compiles function code.
+    if (m_codeBlock->codeType() != FunctionCode)
+        return;
+
+    Instruction* instructionsBegin = m_codeBlock->instructions().begin();
+    unsigned instructionCount = m_codeBlock->instructions().size();
+    for (unsigned bytecodeOffset = 0; bytecodeOffset < instructionCount; ) {
+        Instruction* currentInstruction = instructionsBegin + bytecodeOffset;
+        OpcodeID opcodeID = m_interpreter->getOpcodeID(currentInstruction->u.opcode);
+        switch (opcodeID) {
+        case op_loop:
+            m_loopHeaders.append(bytecodeOffset + currentInstruction[1].u.operand);
+            break;
+        case op_loop_if_true:
+        case op_loop_if_false:
+            m_loopHeaders.append(bytecodeOffset + currentInstruction[2].u.operand);
+            break;
+        case op_loop_if_less:
+        case op_loop_if_lesseq:
+            m_loopHeaders.append(bytecodeOffset + currentInstruction[3].u.operand);
+            break;
+        default:
+            break;
+        }
+        bytecodeOffset += opcodeLengths[opcodeID];
+    }
+
+    if (m_loopHeaders.isEmpty())
+        return;
+
+    std::sort(m_loopHeaders.begin(), m_loopHeaders.end());
+    m_codeBlock->setLoopOptimizationPending();
+}
+
+void JIT::emitOptimizationCheck()
+{
+    // Count executions of the loop header up to zero; once hot, try to enter code generated
+    // by the DFG JIT. cti_optimize_from_loop returns the entry point, or null.
+    move(TrustedImmPtr(m_codeBlock->addressOfOptimizationCounter()), regT1);
+    Jump skipOptimize = branchAdd32(NonZero, TrustedImm32(1), Address(regT1));
+    JITStubCall stubCall(this, cti_optimize_from_loop);
+    stubCall.addArgument(TrustedImm32(m_bytecodeOffset));
+    stubCall.call();
+    Jump noEntry = branchTestPtr(Zero, regT0);
+    jump(regT0);
+    noEntry.link(this);
+    skipOptimize.link(this);
+}
+#endif
+
 #define NEXT_OPCODE(name) \
     m_bytecodeOffset += OPCODE_LENGTH(name); \
     break;
@@ -173,6 +226,9 @@ void JIT::privateCompileMainPass()
     m_propertyAccessInstructionIndex = 0;
     m_globalResolveInfoIndex = 0;
     m_callLinkInfoIndex = 0;
+#if ENABLE(DFG_JIT)
+    m_loopHeaderIndex = 0;
+#endif
 
     for (m_bytecodeOffset = 0; m_bytecodeOffset < instructionCount; ) {
         Instruction* currentInstruction = instructionsBegin + m_bytecodeOffset;
@@ -190,6 +246,15 @@ void JIT::privateCompileMainPass()
 
         m_labels[m_bytecodeOffset] = label();
 
+#if ENABLE(DFG_JIT)
+        if (m_loopHeaderIndex < m_loopHeaders.size() && m_loopHeaders[m_loopHeaderIndex] == m_bytecodeOffset) {
+            emitOptimizationCheck();
+            // Several back edges may share a loop header.
+            while (m_loopHeaderIndex < m_loopHeaders.size() && m_loopHeaders[m_loopHeaderIndex] == m_bytecodeOffset)
+                ++m_loopHeaderIndex;
+        }
+#endif
+
         switch (m_interpreter->getOpcodeID(currentInstruction->u.opcode)) {
         DEFINE_BINARY_OP(op_del_by_val)
         DEFINE_BINARY_OP(op_in)
@@ -339,6 +404,10 @@ void JIT::privateCompileMainPass()
         case op_put_by_id_generic:
         case op_put_by_id_replace:
         case op_put_by_id_transition:
+        case op_mov_mov:
+        case op_add_mov:
+        case op_bitand_jfalse:
+        case op_pre_inc_loop_if_less:
             ASSERT_NOT_REACHED();
         }
     }
@@ -486,6 +555,10 @@ JITCode JIT::privateCompile(CodePtr* functionEntryArityCheck)
 
     Label functionBody = label();
 
+#if ENABLE(DFG_JIT)
+    findLoopHeaders();
+#endif
+
     privateCompileMainPass();
     privateCompileLinkPass();
     privateCompileSlowCases();
@@ -217,6 +217,12 @@ namespace JSC {
             jit.privateCompilePutByIdTransition(stubInfo, oldStructure, newStructure, cachedOffset, chain, returnAddress, direct);
         }
 
+        static void compilePutByIdReplaceList(JSGlobalData* globalData, CodeBlock* codeBlock, PolymorphicAccessStructureList* polymorphicStructures, int currentIndex, Structure* structure, size_t cachedOffset, ReturnAddressPtr returnAddress, bool direct)
+        {
+            JIT jit(globalData, codeBlock);
+            jit.privateCompilePutByIdReplaceList(polymorphicStructures, currentIndex, structure, cachedOffset, returnAddress, direct);
+        }
+
         static void compileCTIMachineTrampolines(JSGlobalData* globalData, RefPtr<ExecutablePool>* executablePool, TrampolineStructure *trampolines)
         {
             if (!globalData->canUseJIT())
@@ -270,6 +276,7 @@ namespace JSC {
         void privateCompileGetByIdChainList(StructureStubInfo*, PolymorphicAccessStructureList*, int, Structure*, StructureChain* chain, size_t count, const Identifier&, const PropertySlot&, size_t cachedOffset, CallFrame* callFrame);
         void privateCompileGetByIdChain(StructureStubInfo*, Structure*, StructureChain*, size_t count, const Identifier&, const PropertySlot&, size_t cachedOffset, ReturnAddressPtr returnAddress, CallFrame* callFrame);
         void privateCompilePutByIdTransition(StructureStubInfo*, Structure*, Structure*, size_t cachedOffset, StructureChain*, ReturnAddressPtr returnAddress, bool direct);
+        void privateCompilePutByIdReplaceList(PolymorphicAccessStructureList*, int, Structure*, size_t cachedOffset, ReturnAddressPtr returnAddress, bool direct);
 
         void privateCompileCTIMachineTrampolines(RefPtr<ExecutablePool>* executablePool, JSGlobalData* data, TrampolineStructure *trampolines);
         Label privateCompileCTINativeCall(JSGlobalData*, bool isConstruct = false);
@@ -296,6 +303,10 @@ namespace JSC {
 
         void testPrototype(JSValue, JumpList& failureCases);
 
+        // Widens the indexing shape of a JSArray's 'storage' to admit the value being stored;
+        // on JSVALUE32_64 'value' holds only the tag.
+        void emitUpdateArrayIndexingShape(RegisterID storage, RegisterID value);
+
 #if USE(JSVALUE32_64)
         bool getOperandConstantImmediateInt(unsigned op1, unsigned op2, unsigned& op, int32_t& constant);
 
@@ -933,6 +944,10 @@ namespace JSC {
         void emitLoadCharacterString(RegisterID src, RegisterID dst, JumpList& failures);
         
         void emitTimeoutCheck();
+#if ENABLE(DFG_JIT)
+        void findLoopHeaders();
+        void emitOptimizationCheck();
+#endif
 #ifndef NDEBUG
         void printBytecodeOperandTypes(unsigned src1, unsigned src2);
 #endif
@@ -976,6 +991,13 @@ namespace JSC {
         unsigned m_globalResolveInfoIndex;
         unsigned m_callLinkInfoIndex;
 
+#if ENABLE(DFG_JIT)
+        // The targets of loop back edges, in bytecode order; each is a potential
+        // entry point into code generated by the DFG JIT.
+        Vector<unsigned> m_loopHeaders;
+        unsigned m_loopHeaderIndex;
+#endif
+
 #if USE(JSVALUE32_64)
         unsigned m_jumpTargetIndex;
         unsigned m_mappedBytecodeOffset;
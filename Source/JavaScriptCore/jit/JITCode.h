@@ -74,6 +74,11 @@ namespace JSC {
         // Execute the code!
         inline JSValue execute(RegisterFile* registerFile, CallFrame* callFrame, JSGlobalData* globalData)
         {
+            // Each entry starts a fresh count towards the next check, so code that is
+            // called back from host functions may never reach one; sample it on entry.
+            if (UNLIKELY(globalData->timeoutChecker.isSampling()) && globalData->timeoutChecker.isSampleDue())
+                Profiler::profiler()->didSample(callFrame, 0);
+
             JSValue result = JSValue::decode(ctiTrampoline(m_ref.m_code.executableAddress(), registerFile, callFrame, 0, Profiler::enabledProfilerReference(), globalData));
             return globalData->exception ? jsNull() : result;
         }
@@ -631,8 +631,38 @@ ALWAYS_INLINE bool JIT::getOperandConstantImmediateInt(unsigned op1, unsigned op
     return false;
 }
 
+inline void JIT::emitUpdateArrayIndexingShape(RegisterID storage, RegisterID tag)
+{
+    Address shape(storage, OBJECT_OFFSETOF(ArrayStorage, m_indexingShape));
+    Jump isContiguous = branch32(Equal, shape, TrustedImm32(ArrayWithContiguous));
+    Jump isInt32 = branch32(Equal, tag, TrustedImm32(JSValue::Int32Tag));
+    Jump isDouble = branch32(Below, tag, TrustedImm32(JSValue::LowestTag));
+    store32(TrustedImm32(ArrayWithContiguous), shape);
+    Jump done = jump();
+    isDouble.link(this);
+    store32(TrustedImm32(ArrayWithDouble), shape);
+    isContiguous.link(this);
+    isInt32.link(this);
+    done.link(this);
+}
+
 #else // USE(JSVALUE32_64)
 
+inline void JIT::emitUpdateArrayIndexingShape(RegisterID storage, RegisterID value)
+{
+    Address shape(storage, OBJECT_OFFSETOF(ArrayStorage, m_indexingShape));
+    Jump isContiguous = branch32(Equal, shape, TrustedImm32(ArrayWithContiguous));
+    Jump isInt32 = branchPtr(AboveOrEqual, value, tagTypeNumberRegister);
+    Jump isDouble = branchTestPtr(NonZero, value, tagTypeNumberRegister);
+    store32(TrustedImm32(ArrayWithContiguous), shape);
+    Jump done = jump();
+    isDouble.link(this);
+    store32(TrustedImm32(ArrayWithDouble), shape);
+    isContiguous.link(this);
+    isInt32.link(this);
+    done.link(this);
+}
+
 ALWAYS_INLINE void JIT::killLastResultRegister()
 {
     m_lastResultBytecodeRegister = std::numeric_limits<int>::max();
@@ -1211,6 +1211,10 @@ void JIT::emit_op_enter(Instruction*)
     for (size_t j = 0; j < count; ++j)
         emitInitRegister(j);
 
+    // Code with no loops would otherwise never be seen by the sampling profiler. Code compiled
+    // while not sampling skips the check, and is only sampled at loops and on entry from host code.
+    if (m_globalData->timeoutChecker.isSampling())
+        emitTimeoutCheck();
 }
 
 void JIT::emit_op_create_activation(Instruction* currentInstruction)
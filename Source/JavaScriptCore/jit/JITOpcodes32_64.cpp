@@ -1538,6 +1538,11 @@ void JIT::emit_op_enter(Instruction*)
     // object lifetime and increasing GC pressure.
     for (int i = 0; i < m_codeBlock->m_numVars; ++i)
         emitStore(i, jsUndefined());
+
+    // Code with no loops would otherwise never be seen by the sampling profiler. Code compiled
+    // while not sampling skips the check, and is only sampled at loops and on entry from host code.
+    if (m_globalData->timeoutChecker.isSampling())
+        emitTimeoutCheck();
 }
 
 void JIT::emit_op_create_activation(Instruction* currentInstruction)
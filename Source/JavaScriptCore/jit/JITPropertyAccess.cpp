@@ -201,11 +201,14 @@ void JIT::emit_op_put_by_val(Instruction* currentInstruction)
     addSlowCase(branch32(AboveOrEqual, regT1, Address(regT0, JSArray::vectorLengthOffset())));
 
     loadPtr(Address(regT0, JSArray::storageOffset()), regT2);
+    emitGetVirtualRegister(value, regT3);
+    if (!isOperandConstantImmediateInt(value))
+        emitUpdateArrayIndexingShape(regT2, regT3);
+
     Jump empty = branchTestPtr(Zero, BaseIndex(regT2, regT1, ScalePtr, OBJECT_OFFSETOF(ArrayStorage, m_vector[0])));
 
     Label storeResult(this);
-    emitGetVirtualRegister(value, regT0);
-    storePtr(regT0, BaseIndex(regT2, regT1, ScalePtr, OBJECT_OFFSETOF(ArrayStorage, m_vector[0])));
+    storePtr(regT3, BaseIndex(regT2, regT1, ScalePtr, OBJECT_OFFSETOF(ArrayStorage, m_vector[0])));
     Jump end = jump();
     
     empty.link(this);
@@ -633,6 +636,44 @@ void JIT::privateCompilePutByIdTransition(StructureStubInfo* stubInfo, Structure
     repatchBuffer.relinkCallerToTrampoline(returnAddress, entryLabel);
 }
 
+void JIT::privateCompilePutByIdReplaceList(PolymorphicAccessStructureList* polymorphicStructures, int currentIndex, Structure* structure, size_t cachedOffset, ReturnAddressPtr returnAddress, bool direct)
+{
+    // The slow case call has been relinked to here; regT0 holds the base and regT1 the value.
+    JumpList failureCases;
+    failureCases.append(emitJumpIfNotJSCell(regT0));
+    failureCases.append(branchPtr(NotEqual, Address(regT0, JSCell::structureOffset()), TrustedImmPtr(structure)));
+
+    compilePutDirectOffset(regT0, regT1, structure, cachedOffset);
+    ret();
+
+    // Try the previous stub in the list; the first one falls back to the stub function that grows the list.
+    failureCases.link(this);
+    CodeLocationLabel lastStubBegin = polymorphicStructures->list[currentIndex - 1].stubRoutine;
+    bool hasPreviousStub = lastStubBegin.executableAddress();
+    Jump failureJump;
+    Call failureCall;
+    if (hasPreviousStub)
+        failureJump = jump();
+    else {
+        restoreArgumentReferenceForTrampoline();
+        failureCall = tailRecursiveCall();
+    }
+
+    LinkBuffer patchBuffer(this, m_codeBlock->executablePool(), 0);
+
+    if (hasPreviousStub)
+        patchBuffer.link(failureJump, lastStubBegin);
+    else
+        patchBuffer.link(failureCall, FunctionPtr(direct ? cti_op_put_by_id_direct_replace_list : cti_op_put_by_id_replace_list));
+
+    CodeLocationLabel entryLabel = patchBuffer.finalizeCodeAddendum();
+
+    polymorphicStructures->list[currentIndex].set(*m_globalData, m_codeBlock->ownerExecutable(), entryLabel, structure);
+
+    RepatchBuffer repatchBuffer(m_codeBlock);
+    repatchBuffer.relinkCallerToTrampoline(returnAddress, entryLabel);
+}
+
 void JIT::patchGetByIdSelf(CodeBlock* codeBlock, StructureStubInfo* stubInfo, Structure* structure, size_t cachedOffset, ReturnAddressPtr returnAddress)
 {
     RepatchBuffer repatchBuffer(codeBlock);
@@ -670,9 +711,8 @@ void JIT::patchPutByIdReplace(CodeBlock* codeBlock, StructureStubInfo* stubInfo,
 {
     RepatchBuffer repatchBuffer(codeBlock);
 
-    // We don't want to patch more than once - in future go to cti_op_put_by_id_generic.
-    // Should probably go to cti_op_put_by_id_fail, but that doesn't do anything interesting right now.
-    repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_generic : cti_op_put_by_id_generic));
+    // We don't want to patch more than once - further Structures seen here build a replace list.
+    repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_replace_list : cti_op_put_by_id_replace_list));
 
     int offset = sizeof(JSValue) * cachedOffset;
 
@@ -366,6 +366,11 @@ void JIT::emit_op_put_by_val(Instruction* currentInstruction)
     
     loadPtr(Address(regT0, JSArray::storageOffset()), regT3);
     
+    if (!isOperandConstantImmediateInt(value)) {
+        emitLoadTag(value, regT1);
+        emitUpdateArrayIndexingShape(regT3, regT1);
+    }
+
     Jump empty = branch32(Equal, BaseIndex(regT3, regT2, TimesEight, OBJECT_OFFSETOF(ArrayStorage, m_vector[0]) + OBJECT_OFFSETOF(JSValue, u.asBits.tag)), TrustedImm32(JSValue::EmptyValueTag));
     
     Label storeResult(this);
@@ -656,6 +661,53 @@ void JIT::privateCompilePutByIdTransition(StructureStubInfo* stubInfo, Structure
     repatchBuffer.relinkCallerToTrampoline(returnAddress, entryLabel);
 }
 
+void JIT::privateCompilePutByIdReplaceList(PolymorphicAccessStructureList* polymorphicStructures, int currentIndex, Structure* structure, size_t cachedOffset, ReturnAddressPtr returnAddress, bool direct)
+{
+    // It is assumed that regT0 contains the basePayload and regT1 contains the baseTag.  The value can be found on the stack.
+    JumpList failureCases;
+    failureCases.append(branch32(NotEqual, regT1, TrustedImm32(JSValue::CellTag)));
+    failureCases.append(branchPtr(NotEqual, Address(regT0, JSCell::structureOffset()), TrustedImmPtr(structure)));
+
+#if CPU(MIPS) || CPU(SH4)
+    // For MIPS, we don't add sizeof(void*) to the stack offset.
+    load32(Address(stackPointerRegister, OBJECT_OFFSETOF(JITStackFrame, args[2]) + OBJECT_OFFSETOF(JSValue, u.asBits.payload)), regT3);
+    load32(Address(stackPointerRegister, OBJECT_OFFSETOF(JITStackFrame, args[2]) + OBJECT_OFFSETOF(JSValue, u.asBits.tag)), regT2);
+#else
+    load32(Address(stackPointerRegister, OBJECT_OFFSETOF(JITStackFrame, args[2]) + sizeof(void*) + OBJECT_OFFSETOF(JSValue, u.asBits.payload)), regT3);
+    load32(Address(stackPointerRegister, OBJECT_OFFSETOF(JITStackFrame, args[2]) + sizeof(void*) + OBJECT_OFFSETOF(JSValue, u.asBits.tag)), regT2);
+#endif
+
+    compilePutDirectOffset(regT0, regT2, regT3, structure, cachedOffset);
+    ret();
+
+    // Try the previous stub in the list; the first one falls back to the stub function that grows the list.
+    failureCases.link(this);
+    CodeLocationLabel lastStubBegin = polymorphicStructures->list[currentIndex - 1].stubRoutine;
+    bool hasPreviousStub = lastStubBegin.executableAddress();
+    Jump failureJump;
+    Call failureCall;
+    if (hasPreviousStub)
+        failureJump = jump();
+    else {
+        restoreArgumentReferenceForTrampoline();
+        failureCall = tailRecursiveCall();
+    }
+
+    LinkBuffer patchBuffer(this, m_codeBlock->executablePool(), 0);
+
+    if (hasPreviousStub)
+        patchBuffer.link(failureJump, lastStubBegin);
+    else
+        patchBuffer.link(failureCall, FunctionPtr(direct ? cti_op_put_by_id_direct_replace_list : cti_op_put_by_id_replace_list));
+
+    CodeLocationLabel entryLabel = patchBuffer.finalizeCodeAddendum();
+
+    polymorphicStructures->list[currentIndex].set(*m_globalData, m_codeBlock->ownerExecutable(), entryLabel, structure);
+
+    RepatchBuffer repatchBuffer(m_codeBlock);
+    repatchBuffer.relinkCallerToTrampoline(returnAddress, entryLabel);
+}
+
 void JIT::patchGetByIdSelf(CodeBlock* codeBlock, StructureStubInfo* stubInfo, Structure* structure, size_t cachedOffset, ReturnAddressPtr returnAddress)
 {
     RepatchBuffer repatchBuffer(codeBlock);
@@ -693,9 +745,8 @@ void JIT::patchPutByIdReplace(CodeBlock* codeBlock, StructureStubInfo* stubInfo,
 {
     RepatchBuffer repatchBuffer(codeBlock);
     
-    // We don't want to patch more than once - in future go to cti_op_put_by_id_generic.
-    // Should probably go to cti_op_put_by_id_fail, but that doesn't do anything interesting right now.
-    repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_generic : cti_op_put_by_id_generic));
+    // We don't want to patch more than once - further Structures seen here build a replace list.
+    repatchBuffer.relinkCallerToFunction(returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_replace_list : cti_op_put_by_id_replace_list));
     
     int offset = sizeof(JSValue) * cachedOffset;
 
@@ -751,6 +751,12 @@ __asm void ctiOpThrowNotCaught()
     #define CTI_SAMPLER 0
 #endif
 
+#if ENABLE(SAMPLING_COUNTERS)
+    #define COUNT_PROPERTY_ACCESS_EVENT(name) do { static SamplingCounter counter(name); counter.count(); } while (0)
+#else
+    #define COUNT_PROPERTY_ACCESS_EVENT(name) do { } while (0)
+#endif
+
 JITThunks::JITThunks(JSGlobalData* globalData)
     : m_hostFunctionStubMap(new HostFunctionStubMap)
 {
@@ -1354,9 +1360,38 @@ DEFINE_STUB_FUNCTION(int, timeout_check)
         VM_THROW_EXCEPTION_AT_END();
     }
 
+    if (UNLIKELY(timeoutChecker.isSampling())) {
+        CallFrame* callFrame = stackFrame.callFrame;
+        Profiler::profiler()->didSample(callFrame, callFrame->codeBlock()->bytecodeOffset(STUB_RETURN_ADDRESS));
+    }
+
     return timeoutChecker.ticksUntilNextCheck();
 }
 
+#if ENABLE(DFG_JIT)
+DEFINE_STUB_FUNCTION(void*, optimize_from_loop)
+{
+    STUB_INIT_STACK_FRAME(stackFrame);
+
+    CallFrame* callFrame = stackFrame.callFrame;
+    CodeBlock* codeBlock = callFrame->codeBlock();
+    unsigned bytecodeOffset = stackFrame.args[0].int32();
+
+    if (codeBlock->loopOptimizationState() == CodeBlock::LoopOptimizationPending)
+        codeBlock->optimizeLoops(stackFrame.globalData);
+
+    void* entry = codeBlock->optimizedLoopEntry(bytecodeOffset);
+    // The optimized code may use more registers than the old JIT's code did.
+    if (!entry || !stackFrame.registerFile->grow(callFrame->registers() + codeBlock->m_numCalleeRegisters)) {
+        codeBlock->deferLoopOptimization();
+        return 0;
+    }
+
+    codeBlock->enterOptimizedLoopsEagerly();
+    return entry;
+}
+#endif
+
 DEFINE_STUB_FUNCTION(void*, register_file_check)
 {
     STUB_INIT_STACK_FRAME(stackFrame);
@@ -1493,6 +1528,100 @@ DEFINE_STUB_FUNCTION(void, op_put_by_id_direct_fail)
     CHECK_FOR_EXCEPTION_AT_END();
 }
 
+static void tryCachePutByIdReplaceList(CallFrame* callFrame, ReturnAddressPtr returnAddress, JSValue baseValue, const PutPropertySlot& slot, bool direct)
+{
+    CodeBlock* codeBlock = callFrame->codeBlock();
+
+    // If the base is not the object written to, it must be a proxy for another object.
+    if (!baseValue.isCell() || !slot.isCacheable() || baseValue.asCell()->structure()->isUncacheableDictionary() || baseValue.asCell() != slot.base()) {
+        ctiPatchCallByReturnAddress(codeBlock, returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_generic : cti_op_put_by_id_generic));
+        return;
+    }
+
+    // Transitions are left to the slow case.
+    Structure* structure = baseValue.asCell()->structure();
+    if (slot.type() != PutPropertySlot::ExistingProperty || structure->isDictionary())
+        return;
+
+    StructureStubInfo* stubInfo = &codeBlock->getStubInfo(returnAddress);
+    if (stubInfo->accessType == access_put_by_id_replace) {
+        PolymorphicAccessStructureList* structureList = new PolymorphicAccessStructureList(callFrame->globalData(), codeBlock->ownerExecutable(), CodeLocationLabel(), stubInfo->u.putByIdReplace.baseObjectStructure.get());
+        stubInfo->initPutByIdReplaceList(structureList, 1);
+    }
+    ASSERT(stubInfo->accessType == access_put_by_id_replace_list);
+
+    int listIndex = stubInfo->u.putByIdReplaceList.listSize;
+    if (listIndex < POLYMORPHIC_LIST_CACHE_SIZE) {
+        stubInfo->u.putByIdReplaceList.listSize++;
+        JIT::compilePutByIdReplaceList(callFrame->scopeChain()->globalData, codeBlock, stubInfo->u.putByIdReplaceList.structureList, listIndex, structure, slot.cachedOffset(), returnAddress, direct);
+        COUNT_PROPERTY_ACCESS_EVENT("put_by_id polymorphic stubs");
+    }
+    if (listIndex >= POLYMORPHIC_LIST_CACHE_SIZE - 1) {
+        COUNT_PROPERTY_ACCESS_EVENT("put_by_id megamorphic sites");
+        // Direct puts ignore ReadOnly, so only ordinary puts can share the megamorphic cache.
+        ctiPatchCallByReturnAddress(codeBlock, returnAddress, FunctionPtr(direct ? cti_op_put_by_id_direct_generic : cti_op_put_by_id_megamorphic));
+    }
+}
+
+DEFINE_STUB_FUNCTION(void, op_put_by_id_replace_list)
+{
+    STUB_INIT_STACK_FRAME(stackFrame);
+    CallFrame* callFrame = stackFrame.callFrame;
+
+    PutPropertySlot slot(callFrame->codeBlock()->isStrictMode());
+    JSValue baseValue = stackFrame.args[0].jsValue();
+    baseValue.put(callFrame, stackFrame.args[1].identifier(), stackFrame.args[2].jsValue(), slot);
+    CHECK_FOR_EXCEPTION_VOID();
+
+    tryCachePutByIdReplaceList(callFrame, STUB_RETURN_ADDRESS, baseValue, slot, false);
+}
+
+DEFINE_STUB_FUNCTION(void, op_put_by_id_direct_replace_list)
+{
+    STUB_INIT_STACK_FRAME(stackFrame);
+    CallFrame* callFrame = stackFrame.callFrame;
+
+    PutPropertySlot slot(callFrame->codeBlock()->isStrictMode());
+    JSValue baseValue = stackFrame.args[0].jsValue();
+    baseValue.putDirect(callFrame, stackFrame.args[1].identifier(), stackFrame.args[2].jsValue(), slot);
+    CHECK_FOR_EXCEPTION_VOID();
+
+    tryCachePutByIdReplaceList(callFrame, STUB_RETURN_ADDRESS, baseValue, slot, true);
+}
+
+DEFINE_STUB_FUNCTION(void, op_put_by_id_megamorphic)
+{
+    STUB_INIT_STACK_FRAME(stackFrame);
+
+    CallFrame* callFrame = stackFrame.callFrame;
+    const Identifier& propertyName = stackFrame.args[1].identifier();
+    JSValue baseValue = stackFrame.args[0].jsValue();
+    JSValue value = stackFrame.args[2].jsValue();
+
+    MegamorphicAccessCache& cache = stackFrame.globalData->jitStubs->putByIdCache();
+    if (baseValue.isCell()) {
+        JSObject* slotBase;
+        size_t offset;
+        if (cache.get(baseValue.asCell()->structure(), propertyName.impl(), slotBase, offset)) {
+            ASSERT(!slotBase);
+            COUNT_PROPERTY_ACCESS_EVENT("put_by_id megamorphic cache hits");
+            asObject(baseValue)->putDirectOffset(callFrame->globalData(), offset, value);
+            return;
+        }
+    }
+    COUNT_PROPERTY_ACCESS_EVENT("put_by_id megamorphic cache misses");
+
+    PutPropertySlot slot(callFrame->codeBlock()->isStrictMode());
+    baseValue.put(callFrame, propertyName, value, slot);
+    CHECK_FOR_EXCEPTION_VOID();
+
+    if (!baseValue.isCell() || !slot.isCacheable() || slot.type() != PutPropertySlot::ExistingProperty || baseValue.asCell() != slot.base())
+        return;
+    Structure* structure = baseValue.asCell()->structure();
+    if (!structure->isDictionary())
+        cache.add(structure, propertyName.impl(), 0, slot.cachedOffset());
+}
+
 DEFINE_STUB_FUNCTION(JSObject*, op_put_by_id_transition_realloc)
 {
     STUB_INIT_STACK_FRAME(stackFrame);
@@ -1639,9 +1768,12 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_self_fail)
         if (listIndex < POLYMORPHIC_LIST_CACHE_SIZE) {
             stubInfo->u.getByIdSelfList.listSize++;
             JIT::compileGetByIdSelfList(callFrame->scopeChain()->globalData, codeBlock, stubInfo, polymorphicStructureList, listIndex, baseValue.asCell()->structure(), ident, slot, slot.cachedOffset());
+            COUNT_PROPERTY_ACCESS_EVENT("get_by_id polymorphic stubs");
 
-            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1))
-                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_generic));
+            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1)) {
+                COUNT_PROPERTY_ACCESS_EVENT("get_by_id megamorphic sites");
+                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_megamorphic));
+            }
         }
     } else
         ctiPatchCallByReturnAddress(callFrame->codeBlock(), STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_generic));
@@ -1751,9 +1883,12 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_proto_list)
         PolymorphicAccessStructureList* prototypeStructureList = getPolymorphicAccessStructureListSlot(callFrame->globalData(), codeBlock->ownerExecutable(), stubInfo, listIndex);
         if (listIndex < POLYMORPHIC_LIST_CACHE_SIZE) {
             JIT::compileGetByIdProtoList(callFrame->scopeChain()->globalData, callFrame, codeBlock, stubInfo, prototypeStructureList, listIndex, structure, slotBaseObject->structure(), propertyName, slot, offset);
+            COUNT_PROPERTY_ACCESS_EVENT("get_by_id polymorphic stubs");
 
-            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1))
-                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_proto_list_full));
+            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1)) {
+                COUNT_PROPERTY_ACCESS_EVENT("get_by_id megamorphic sites");
+                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_megamorphic));
+            }
         }
     } else if (size_t count = normalizePrototypeChain(callFrame, baseValue, slot.slotBase(), propertyName, offset)) {
         ASSERT(!baseValue.asCell()->structure()->isDictionary());
@@ -1763,9 +1898,12 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_proto_list)
         if (listIndex < POLYMORPHIC_LIST_CACHE_SIZE) {
             StructureChain* protoChain = structure->prototypeChain(callFrame);
             JIT::compileGetByIdChainList(callFrame->scopeChain()->globalData, callFrame, codeBlock, stubInfo, prototypeStructureList, listIndex, structure, protoChain, count, propertyName, slot, offset);
+            COUNT_PROPERTY_ACCESS_EVENT("get_by_id polymorphic stubs");
 
-            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1))
-                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_proto_list_full));
+            if (listIndex == (POLYMORPHIC_LIST_CACHE_SIZE - 1)) {
+                COUNT_PROPERTY_ACCESS_EVENT("get_by_id megamorphic sites");
+                ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_megamorphic));
+            }
         }
     } else
         ctiPatchCallByReturnAddress(codeBlock, STUB_RETURN_ADDRESS, FunctionPtr(cti_op_get_by_id_proto_fail));
@@ -1773,15 +1911,46 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_proto_list)
     return JSValue::encode(result);
 }
 
-DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_proto_list_full)
+DEFINE_STUB_FUNCTION(EncodedJSValue, op_get_by_id_megamorphic)
 {
     STUB_INIT_STACK_FRAME(stackFrame);
 
+    CallFrame* callFrame = stackFrame.callFrame;
+    const Identifier& propertyName = stackFrame.args[1].identifier();
     JSValue baseValue = stackFrame.args[0].jsValue();
+
+    MegamorphicAccessCache& cache = stackFrame.globalData->jitStubs->getByIdCache();
+    if (baseValue.isCell()) {
+        JSObject* slotBase;
+        size_t offset;
+        if (cache.get(baseValue.asCell()->structure(), propertyName.impl(), slotBase, offset)) {
+            COUNT_PROPERTY_ACCESS_EVENT("get_by_id megamorphic cache hits");
+            if (!slotBase)
+                return JSValue::encode(asObject(baseValue)->getDirectOffset(offset));
+            return JSValue::encode(slotBase->getDirectOffset(offset));
+        }
+    }
+    COUNT_PROPERTY_ACCESS_EVENT("get_by_id megamorphic cache misses");
+
     PropertySlot slot(baseValue);
-    JSValue result = baseValue.get(stackFrame.callFrame, stackFrame.args[1].identifier(), slot);
+    JSValue result = baseValue.get(callFrame, propertyName, slot);
+
+    CHECK_FOR_EXCEPTION();
+
+    // Only objects are cached, since the prototype of any other cell depends on the global object.
+    if (!baseValue.isObject() || !slot.isCacheable() || slot.cachedPropertyType() != PropertySlot::Value)
+        return JSValue::encode(result);
+
+    Structure* structure = baseValue.asCell()->structure();
+    if (structure->isDictionary())
+        return JSValue::encode(result);
+
+    JSObject* slotBaseObject = asObject(slot.slotBase());
+    if (slot.slotBase() == baseValue)
+        cache.add(structure, propertyName.impl(), 0, slot.cachedOffset());
+    else if (slot.slotBase() == structure->storedPrototype() && !slotBaseObject->structure()->isDictionary())
+        cache.add(structure, propertyName.impl(), slotBaseObject, slot.cachedOffset());
 
-    CHECK_FOR_EXCEPTION_AT_END();
     return JSValue::encode(result);
 }
 
@@ -2748,6 +2917,9 @@ DEFINE_STUB_FUNCTION(EncodedJSValue, op_resolve_global)
     unsigned globalResolveInfoIndex = stackFrame.args[1].int32();
     ASSERT(globalObject->isGlobalObject());
 
+    if (globalObject->structure()->isUncacheableDictionary())
+        globalObject->flattenDictionaryObject(callFrame->globalData());
+
     PropertySlot slot(globalObject);
     if (globalObject->getPropertySlot(callFrame, ident, slot)) {
         JSValue result = slot.getValue(callFrame, ident);
@@ -3608,6 +3780,56 @@ void JITThunks::clearHostFunctionStubs()
     m_hostFunctionStubMap.clear();
 }
 
+MegamorphicAccessCache& JITThunks::getByIdCache()
+{
+    if (!m_getByIdCache)
+        m_getByIdCache = adoptPtr(new MegamorphicAccessCache);
+    return *m_getByIdCache;
+}
+
+MegamorphicAccessCache& JITThunks::putByIdCache()
+{
+    if (!m_putByIdCache)
+        m_putByIdCache = adoptPtr(new MegamorphicAccessCache);
+    return *m_putByIdCache;
+}
+
+void JITThunks::clearMegamorphicAccessCaches()
+{
+    if (m_getByIdCache)
+        m_getByIdCache->clear();
+    if (m_putByIdCache)
+        m_putByIdCache->clear();
+}
+
+bool MegamorphicAccessCache::get(Structure* structure, StringImpl* propertyName, JSObject*& slotBase, size_t& offset)
+{
+    Entry& entry = m_entries[hash(structure, propertyName)];
+    if (entry.structure != structure || entry.propertyName != propertyName)
+        return false;
+    if (entry.slotBase && entry.slotBase->structure() != entry.slotBaseStructure)
+        return false;
+    slotBase = entry.slotBase;
+    offset = entry.offset;
+    return true;
+}
+
+void MegamorphicAccessCache::add(Structure* structure, StringImpl* propertyName, JSObject* slotBase, size_t offset)
+{
+    Entry& entry = m_entries[hash(structure, propertyName)];
+    entry.structure = structure;
+    entry.propertyName = propertyName;
+    entry.slotBase = slotBase;
+    entry.slotBaseStructure = slotBase ? slotBase->structure() : 0;
+    entry.offset = offset;
+}
+
+void MegamorphicAccessCache::clear()
+{
+    for (unsigned i = 0; i < cacheSize; ++i)
+        m_entries[i] = Entry();
+}
+
 } // namespace JSC
 
 #endif // ENABLE(JIT)
@@ -35,6 +35,7 @@
 #include "Register.h"
 #include "ThunkGenerators.h"
 #include <wtf/HashMap.h>
+#include <wtf/text/StringImpl.h>
 
 #if ENABLE(JIT)
 
@@ -58,6 +59,7 @@ namespace JSC {
     class PutPropertySlot;
     class RegisterFile;
     class RegExp;
+    class Structure;
 
     union JITStubArg {
         void* asPointer;
@@ -277,6 +279,47 @@ namespace JSC {
 
     template <typename T> class Strong;
 
+    // Shared by the get_by_id and put_by_id sites that have seen more Structures than a polymorphic
+    // list can hold.  Maps a (Structure, property name) pair to the offset of the property, and for
+    // gets also to the prototype holding it.  Entries hold raw Structure and object pointers, so the
+    // cache is cleared on every garbage collection.
+    class MegamorphicAccessCache {
+        WTF_MAKE_NONCOPYABLE(MegamorphicAccessCache); WTF_MAKE_FAST_ALLOCATED;
+    public:
+        MegamorphicAccessCache() { }
+
+        // On success slotBase is 0 if the property is on the base object itself.
+        bool get(Structure*, StringImpl* propertyName, JSObject*& slotBase, size_t& offset);
+        void add(Structure*, StringImpl* propertyName, JSObject* slotBase, size_t offset);
+        void clear();
+
+    private:
+        static const unsigned cacheSize = 512;
+
+        struct Entry {
+            Entry()
+                : structure(0)
+                , slotBase(0)
+                , slotBaseStructure(0)
+                , offset(0)
+            {
+            }
+
+            Structure* structure;
+            RefPtr<StringImpl> propertyName;
+            JSObject* slotBase;
+            Structure* slotBaseStructure;
+            size_t offset;
+        };
+
+        static unsigned hash(Structure* structure, StringImpl* propertyName)
+        {
+            return ((reinterpret_cast<uintptr_t>(structure) >> 4) ^ propertyName->existingHash()) & (cacheSize - 1);
+        }
+
+        Entry m_entries[cacheSize];
+    };
+
     class JITThunks {
     public:
         JITThunks(JSGlobalData*);
@@ -301,6 +344,10 @@ namespace JSC {
 
         void clearHostFunctionStubs();
 
+        MegamorphicAccessCache& getByIdCache();
+        MegamorphicAccessCache& putByIdCache();
+        void clearMegamorphicAccessCaches();
+
     private:
         typedef HashMap<ThunkGenerator, MacroAssemblerCodePtr> CTIStubMap;
         CTIStubMap m_ctiStubMap;
@@ -309,6 +356,9 @@ namespace JSC {
         RefPtr<ExecutablePool> m_executablePool;
 
         TrampolineStructure m_trampolineStructure;
+
+        OwnPtr<MegamorphicAccessCache> m_getByIdCache;
+        OwnPtr<MegamorphicAccessCache> m_putByIdCache;
     };
 
 extern "C" {
@@ -333,10 +383,10 @@ extern "C" {
     EncodedJSValue JIT_STUB cti_op_get_by_id_custom_stub(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_generic(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_getter_stub(STUB_ARGS_DECLARATION);
+    EncodedJSValue JIT_STUB cti_op_get_by_id_megamorphic(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_method_check(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_proto_fail(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_proto_list(STUB_ARGS_DECLARATION);
-    EncodedJSValue JIT_STUB cti_op_get_by_id_proto_list_full(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_self_fail(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_id_string_fail(STUB_ARGS_DECLARATION);
     EncodedJSValue JIT_STUB cti_op_get_by_val(STUB_ARGS_DECLARATION);
@@ -408,9 +458,12 @@ extern "C" {
     void JIT_STUB cti_op_put_by_id(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_id_fail(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_id_generic(STUB_ARGS_DECLARATION);
+    void JIT_STUB cti_op_put_by_id_megamorphic(STUB_ARGS_DECLARATION);
+    void JIT_STUB cti_op_put_by_id_replace_list(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_id_direct(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_id_direct_fail(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_id_direct_generic(STUB_ARGS_DECLARATION);
+    void JIT_STUB cti_op_put_by_id_direct_replace_list(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_index(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_val(STUB_ARGS_DECLARATION);
     void JIT_STUB cti_op_put_by_val_byte_array(STUB_ARGS_DECLARATION);
@@ -427,6 +480,9 @@ extern "C" {
     void* JIT_STUB cti_op_switch_imm(STUB_ARGS_DECLARATION);
     void* JIT_STUB cti_op_switch_string(STUB_ARGS_DECLARATION);
     void* JIT_STUB cti_op_throw(STUB_ARGS_DECLARATION);
+#if ENABLE(DFG_JIT)
+    void* JIT_STUB cti_optimize_from_loop(STUB_ARGS_DECLARATION);
+#endif
     void* JIT_STUB cti_register_file_check(STUB_ARGS_DECLARATION);
     void* JIT_STUB cti_vm_lazyLinkCall(STUB_ARGS_DECLARATION);
     void* JIT_STUB cti_vm_lazyLinkConstruct(STUB_ARGS_DECLARATION);
@@ -31,6 +31,9 @@
 #include "JSFunction.h"
 #include "JSLock.h"
 #include "JSString.h"
+#include "Lexer.h"
+#include "ParserArena.h"
+#include "Profiler.h"
 #include "SamplingTool.h"
 #include <math.h>
 #include <stdio.h>
@@ -101,11 +104,15 @@ struct Options {
     Options()
         : interactive(false)
         , dump(false)
+        , lexOnly(false)
+        , profilePath(0)
     {
     }
 
     bool interactive;
     bool dump;
+    bool lexOnly;
+    const char* profilePath;
     Vector<Script> scripts;
     Vector<UString> arguments;
 };
@@ -371,7 +378,7 @@ static void cleanupGlobalData(JSGlobalData* globalData)
     globalData->deref();
 }
 
-static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scripts, bool dump)
+static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scripts, bool dump, const char* profilePath)
 {
     UString script;
     UString fileName;
@@ -382,6 +389,9 @@ static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scr
 
     JSGlobalData& globalData = globalObject->globalData();
 
+    if (profilePath)
+        Profiler::profiler()->startSampling(globalObject->globalExec(), "jsc");
+
 #if ENABLE(SAMPLING_FLAGS)
     SamplingFlags::start();
 #endif
@@ -416,6 +426,14 @@ static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scr
 #if ENABLE(SAMPLING_FLAGS)
     SamplingFlags::stop();
 #endif
+    if (profilePath) {
+        RefPtr<Profile> profile = Profiler::profiler()->stopSampling(globalObject->globalExec(), "jsc");
+        if (FILE* file = fopen(profilePath, "w")) {
+            profile->printFlatData(file);
+            fclose(file);
+        } else
+            fprintf(stderr, "Could not open file: %s\n", profilePath);
+    }
     globalData.dumpSampleData(globalObject->globalExec());
 #if ENABLE(SAMPLING_COUNTERS)
     AbstractSamplingCounter::dump();
@@ -426,6 +444,86 @@ static bool runWithScripts(GlobalObject* globalObject, const Vector<Script>& scr
     return success;
 }
 
+static bool tokenCanPrecedeDivision(JSTokenType token)
+{
+    switch (token) {
+    case IDENT:
+    case NUMBER:
+    case STRING:
+    case CLOSEPAREN:
+    case CLOSEBRACKET:
+    case CLOSEBRACE:
+    case THISTOKEN:
+    case NULLTOKEN:
+    case TRUETOKEN:
+    case FALSETOKEN:
+    case PLUSPLUS:
+    case MINUSMINUS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Runs only the lexer over each script, so that tokenizer changes can be measured on real-world
+// bundles without the parser and bytecode generator in the picture. The lexer cannot tell a
+// division from the start of a regular expression literal on its own, so we use the previous
+// token to decide, which is good enough for benchmarking purposes.
+static bool runLexerBenchmark(JSGlobalData& globalData, const Vector<Script>& scripts)
+{
+    Vector<char> scriptBuffer;
+    bool success = true;
+    for (size_t i = 0; i < scripts.size(); i++) {
+        UString script;
+        UString fileName;
+        if (scripts[i].isFile) {
+            fileName = scripts[i].argument;
+            if (!fillBufferWithContentsOfFile(fileName, scriptBuffer))
+                return false;
+            script = scriptBuffer.data();
+        } else {
+            script = scripts[i].argument;
+            fileName = "[Command Line]";
+        }
+
+        SourceCode source = makeSource(script, fileName);
+        ParserArena arena;
+        Lexer& lexer = *globalData.lexer;
+        JSTokenData tokenData;
+        JSTokenInfo tokenInfo;
+        JSTokenType token = EOFTOK;
+        JSTokenType previousToken = SEMICOLON;
+        size_t tokenCount = 0;
+
+        StopWatch stopWatch;
+        stopWatch.start();
+        lexer.setCode(source, arena);
+        while (true) {
+            token = lexer.lex(&tokenData, &tokenInfo, Lexer::IdentifyReservedWords, false);
+            if (token == EOFTOK || token == ERRORTOK)
+                break;
+            if ((token == DIVIDE || token == DIVEQUAL) && !tokenCanPrecedeDivision(previousToken)) {
+                if (!lexer.skipRegExp()) {
+                    token = ERRORTOK;
+                    break;
+                }
+                token = STRING;
+            }
+            previousToken = token;
+            ++tokenCount;
+        }
+        stopWatch.stop();
+
+        if (token == ERRORTOK) {
+            printf("%s: lexer error on line %d\n", fileName.utf8().data(), lexer.lineNumber());
+            success = false;
+        } else
+            printf("%s: %lu tokens, %u characters in %ld ms\n", fileName.utf8().data(), static_cast<unsigned long>(tokenCount), script.length(), stopWatch.getElapsedMS());
+        lexer.clear();
+    }
+    return success;
+}
+
 #define RUNNING_FROM_XCODE 0
 
 static void runInteractive(GlobalObject* globalObject)
@@ -472,6 +570,8 @@ static NO_RETURN void printUsageStatement(JSGlobalData* globalData, bool help =
     fprintf(stderr, "  -f         Specifies a source file (deprecated)\n");
     fprintf(stderr, "  -h|--help  Prints this help message\n");
     fprintf(stderr, "  -i         Enables interactive mode (default if no files are specified)\n");
+    fprintf(stderr, "  -l         Only runs the lexer over the given scripts and reports timings\n");
+    fprintf(stderr, "  -p file    Samples the scripts with the sampling profiler and writes a flat profile to file\n");
 #if HAVE(SIGNAL_H)
     fprintf(stderr, "  -s         Installs signal handlers that exit on a crash (Unix platforms only)\n");
 #endif
@@ -505,6 +605,16 @@ static void parseArguments(int argc, char** argv, Options& options, JSGlobalData
             options.dump = true;
             continue;
         }
+        if (!strcmp(arg, "-l")) {
+            options.lexOnly = true;
+            continue;
+        }
+        if (!strcmp(arg, "-p")) {
+            if (++i == argc)
+                printUsageStatement(globalData);
+            options.profilePath = argv[i];
+            continue;
+        }
         if (!strcmp(arg, "-s")) {
 #if HAVE(SIGNAL_H)
             signal(SIGILL, _exit);
@@ -537,8 +647,11 @@ int jscmain(int argc, char** argv, JSGlobalData* globalData)
     Options options;
     parseArguments(argc, argv, options, globalData);
 
+    if (options.lexOnly)
+        return runLexerBenchmark(*globalData, options.scripts) ? 0 : 3;
+
     GlobalObject* globalObject = new (globalData) GlobalObject(*globalData, options.arguments);
-    bool success = runWithScripts(globalObject, options.scripts, options.dump);
+    bool success = runWithScripts(globalObject, options.scripts, options.dump, options.profilePath);
     if (options.interactive && success)
         runInteractive(globalObject);
 
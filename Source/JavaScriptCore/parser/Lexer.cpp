@@ -36,6 +36,14 @@
 #include <string.h>
 #include <wtf/Assertions.h>
 
+#if CPU(X86_64) || (CPU(X86) && defined(__SSE2__))
+#define LEXER_SSE2_SCANNING 1
+#include <emmintrin.h>
+#elif CPU(ARM_NEON) && COMPILER(GCC)
+#define LEXER_NEON_SCANNING 1
+#include <arm_neon.h>
+#endif
+
 using namespace WTF;
 using namespace Unicode;
 
@@ -221,6 +229,197 @@ static const unsigned short typesOfASCIICharacters[128] = {
 /* 127 - Delete             */ CharacterInvalid,
 };
 
+// Run scanning.
+//
+// Identifiers, whitespace, comments and string literals are dominated by long runs of
+// plain ASCII characters. The scanners below skip such runs eight characters at a time
+// and return a pointer to the start of the first block that is not entirely part of the
+// run (or of the last, partial block). They never consume anything that needs special
+// handling (non-ASCII characters, line terminators, escapes, quotes), so the regular
+// character-at-a-time loops that follow each call act as the scalar fallback and take
+// care of the tail. On CPUs without a vector path the scanners return immediately.
+
+#if LEXER_SSE2_SCANNING || LEXER_NEON_SCANNING
+
+static const int charactersPerBlock = 8;
+
+#if LEXER_SSE2_SCANNING
+typedef __m128i CharacterBlock;
+
+static ALWAYS_INLINE CharacterBlock loadBlock(const UChar* characters)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters));
+}
+
+static ALWAYS_INLINE CharacterBlock splatCharacter(int character)
+{
+    return _mm_set1_epi16(static_cast<short>(character));
+}
+
+static ALWAYS_INLINE CharacterBlock equalCharacters(CharacterBlock block, int character)
+{
+    return _mm_cmpeq_epi16(block, splatCharacter(character));
+}
+
+// SSE2 only has signed 16-bit comparisons; characters >= 0x8000 compare as negative and
+// therefore never fall in the (ASCII) ranges we are interested in.
+static ALWAYS_INLINE CharacterBlock charactersInRange(CharacterBlock block, int low, int high)
+{
+    return _mm_and_si128(_mm_cmpgt_epi16(block, splatCharacter(low - 1)), _mm_cmplt_epi16(block, splatCharacter(high + 1)));
+}
+
+static ALWAYS_INLINE CharacterBlock orBlocks(CharacterBlock a, CharacterBlock b)
+{
+    return _mm_or_si128(a, b);
+}
+
+static ALWAYS_INLINE CharacterBlock andNotBlocks(CharacterBlock a, CharacterBlock b)
+{
+    return _mm_andnot_si128(b, a);
+}
+
+static ALWAYS_INLINE bool allCharactersMatch(CharacterBlock mask)
+{
+    return _mm_movemask_epi8(mask) == 0xFFFF;
+}
+#else
+typedef uint16x8_t CharacterBlock;
+
+static ALWAYS_INLINE CharacterBlock loadBlock(const UChar* characters)
+{
+    return vld1q_u16(reinterpret_cast<const uint16_t*>(characters));
+}
+
+static ALWAYS_INLINE CharacterBlock splatCharacter(int character)
+{
+    return vdupq_n_u16(static_cast<uint16_t>(character));
+}
+
+static ALWAYS_INLINE CharacterBlock equalCharacters(CharacterBlock block, int character)
+{
+    return vceqq_u16(block, splatCharacter(character));
+}
+
+static ALWAYS_INLINE CharacterBlock charactersInRange(CharacterBlock block, int low, int high)
+{
+    return vandq_u16(vcgeq_u16(block, splatCharacter(low)), vcleq_u16(block, splatCharacter(high)));
+}
+
+static ALWAYS_INLINE CharacterBlock orBlocks(CharacterBlock a, CharacterBlock b)
+{
+    return vorrq_u16(a, b);
+}
+
+static ALWAYS_INLINE CharacterBlock andNotBlocks(CharacterBlock a, CharacterBlock b)
+{
+    return vbicq_u16(a, b);
+}
+
+static ALWAYS_INLINE bool allCharactersMatch(CharacterBlock mask)
+{
+    uint32x2_t halves = vreinterpret_u32_u16(vand_u16(vget_low_u16(mask), vget_high_u16(mask)));
+    return (vget_lane_u32(halves, 0) & vget_lane_u32(halves, 1)) == 0xFFFFFFFF;
+}
+#endif
+
+// [A-Za-z0-9$_]
+static ALWAYS_INLINE CharacterBlock identifierPartMask(CharacterBlock block)
+{
+    CharacterBlock letters = charactersInRange(orBlocks(block, splatCharacter(0x20)), 'a', 'z');
+    CharacterBlock digits = charactersInRange(block, '0', '9');
+    return orBlocks(orBlocks(letters, digits), orBlocks(equalCharacters(block, '$'), equalCharacters(block, '_')));
+}
+
+// Space and horizontal tab; the other whitespace characters are rare enough to leave to isWhiteSpace().
+static ALWAYS_INLINE CharacterBlock whiteSpaceMask(CharacterBlock block)
+{
+    return orBlocks(equalCharacters(block, ' '), equalCharacters(block, '\t'));
+}
+
+// Printable ASCII other than the quote character and backslash.
+static ALWAYS_INLINE CharacterBlock stringCharacterMask(CharacterBlock block, int quoteCharacter)
+{
+    CharacterBlock special = orBlocks(equalCharacters(block, quoteCharacter), equalCharacters(block, '\\'));
+    return andNotBlocks(charactersInRange(block, 0x20, 0x7E), special);
+}
+
+// ASCII other than line terminators.
+static ALWAYS_INLINE CharacterBlock singleLineCommentMask(CharacterBlock block)
+{
+    CharacterBlock lineTerminators = orBlocks(equalCharacters(block, '\n'), equalCharacters(block, '\r'));
+    return andNotBlocks(charactersInRange(block, 0, 0x7F), lineTerminators);
+}
+
+// ASCII other than line terminators and '*'.
+static ALWAYS_INLINE CharacterBlock multiLineCommentMask(CharacterBlock block)
+{
+    return andNotBlocks(singleLineCommentMask(block), equalCharacters(block, '*'));
+}
+
+#define SCAN_BLOCKS(maskExpression) \
+    for (; end - position >= charactersPerBlock; position += charactersPerBlock) { \
+        CharacterBlock block = loadBlock(position); \
+        if (!allCharactersMatch(maskExpression)) \
+            break; \
+    } \
+    return position
+
+static ALWAYS_INLINE const UChar* scanIdentifierPart(const UChar* position, const UChar* end)
+{
+    SCAN_BLOCKS(identifierPartMask(block));
+}
+
+static ALWAYS_INLINE const UChar* scanWhiteSpace(const UChar* position, const UChar* end)
+{
+    SCAN_BLOCKS(whiteSpaceMask(block));
+}
+
+static ALWAYS_INLINE const UChar* scanStringCharacters(const UChar* position, const UChar* end, int quoteCharacter)
+{
+    SCAN_BLOCKS(stringCharacterMask(block, quoteCharacter));
+}
+
+static ALWAYS_INLINE const UChar* scanSingleLineComment(const UChar* position, const UChar* end)
+{
+    SCAN_BLOCKS(singleLineCommentMask(block));
+}
+
+static ALWAYS_INLINE const UChar* scanMultiLineComment(const UChar* position, const UChar* end)
+{
+    SCAN_BLOCKS(multiLineCommentMask(block));
+}
+
+#undef SCAN_BLOCKS
+
+#else
+
+static ALWAYS_INLINE const UChar* scanIdentifierPart(const UChar* position, const UChar*)
+{
+    return position;
+}
+
+static ALWAYS_INLINE const UChar* scanWhiteSpace(const UChar* position, const UChar*)
+{
+    return position;
+}
+
+static ALWAYS_INLINE const UChar* scanStringCharacters(const UChar* position, const UChar*, int)
+{
+    return position;
+}
+
+static ALWAYS_INLINE const UChar* scanSingleLineComment(const UChar* position, const UChar*)
+{
+    return position;
+}
+
+static ALWAYS_INLINE const UChar* scanMultiLineComment(const UChar* position, const UChar*)
+{
+    return position;
+}
+
+#endif // LEXER_SSE2_SCANNING || LEXER_NEON_SCANNING
+
 Lexer::Lexer(JSGlobalData* globalData)
     : m_isReparsing(false)
     , m_globalData(globalData)
@@ -281,6 +480,17 @@ ALWAYS_INLINE void Lexer::shift()
         m_current = *m_code;
 }
 
+ALWAYS_INLINE void Lexer::skipTo(const UChar* position)
+{
+    ASSERT(position >= m_code && position <= m_codeEnd);
+    if (position == m_code)
+        return;
+    m_code = position;
+    m_current = -1;
+    if (LIKELY(m_code < m_codeEnd))
+        m_current = *m_code;
+}
+
 ALWAYS_INLINE int Lexer::peek(int offset)
 {
     // Only use if necessary
@@ -406,10 +616,9 @@ ALWAYS_INLINE JSTokenType Lexer::parseIdentifier(JSTokenData* lvalp, LexType lex
     int identifierLength;
 
     while (true) {
-        if (LIKELY(isIdentPart(m_current))) {
+        skipTo(scanIdentifierPart(currentCharacter(), m_codeEnd));
+        while (LIKELY(isIdentPart(m_current)))
             shift();
-            continue;
-        }
         if (LIKELY(m_current != '\\'))
             break;
 
@@ -459,6 +668,7 @@ ALWAYS_INLINE bool Lexer::parseString(JSTokenData* lvalp, bool strictMode)
     shift();
 
     const UChar* stringStart = currentCharacter();
+    skipTo(scanStringCharacters(stringStart, m_codeEnd, stringQuoteCharacter));
 
     while (m_current != stringQuoteCharacter) {
         if (UNLIKELY(m_current == '\\')) {
@@ -521,6 +731,7 @@ ALWAYS_INLINE bool Lexer::parseString(JSTokenData* lvalp, bool strictMode)
                 return false;
 
             stringStart = currentCharacter();
+            skipTo(scanStringCharacters(stringStart, m_codeEnd, stringQuoteCharacter));
             continue;
         }
         // Fast check for characters that require special handling.
@@ -685,6 +896,7 @@ ALWAYS_INLINE bool Lexer::parseNumberAfterExponentIndicator()
 ALWAYS_INLINE bool Lexer::parseMultilineComment()
 {
     while (true) {
+        skipTo(scanMultiLineComment(currentCharacter(), m_codeEnd));
         while (UNLIKELY(m_current == '*')) {
             shift();
             if (m_current == '/') {
@@ -722,6 +934,7 @@ JSTokenType Lexer::lex(JSTokenData* lvalp, JSTokenInfo* llocp, LexType lexType,
     m_terminator = false;
 
 start:
+    skipTo(scanWhiteSpace(currentCharacter(), m_codeEnd));
     while (isWhiteSpace(m_current))
         shift();
 
@@ -1054,6 +1267,7 @@ inNumberAfterDecimalPoint:
     goto returnToken;
 
 inSingleLineComment:
+    skipTo(scanSingleLineComment(currentCharacter(), m_codeEnd));
     while (!isLineTerminator(m_current)) {
         if (UNLIKELY(m_current == -1))
             return EOFTOK;
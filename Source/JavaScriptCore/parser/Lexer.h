@@ -98,6 +98,7 @@ namespace JSC {
         void copyCodeWithoutBOMs();
 
         ALWAYS_INLINE void shift();
+        ALWAYS_INLINE void skipTo(const UChar*);
         ALWAYS_INLINE int peek(int offset);
         int getUnicodeCharacter();
         void shiftLineTerminator();
@@ -28,6 +28,7 @@
 
 #include "ProfileNode.h"
 #include <stdio.h>
+#include <wtf/Vector.h>
 
 namespace JSC {
 
@@ -99,6 +100,66 @@ void Profile::restoreAll()
     forEach(&ProfileNode::restore);
 }
 
+void Profile::didSampleLine(const CallIdentifier& location, double time)
+{
+    SampledLine& line = m_sampledLines.add(location, SampledLine()).first->second;
+    ++line.samples;
+    line.time += time;
+}
+
+typedef std::pair<CallIdentifier, double> CallIdentifierTimePair;
+
+static inline bool callIdentifierTimePairComparator(const CallIdentifierTimePair& a, const CallIdentifierTimePair& b)
+{
+    return a.second > b.second;
+}
+
+static void printFlatLine(FILE* file, const CallIdentifier& callIdentifier, double time, double totalTime)
+{
+    fprintf(file, "%.3f\t%.2f\t%s\t%s:%u\n", time, totalTime ? time / totalTime * 100.0 : 0.0,
+        callIdentifier.m_name.utf8().data(), callIdentifier.m_url.utf8().data(), callIdentifier.m_lineNumber);
+}
+
+void Profile::printFlatData(FILE* file) const
+{
+    double totalTime = m_head->totalTime();
+    fprintf(file, "# %s\n# total %.3fms\n", m_title.utf8().data(), totalTime);
+
+    HashMap<CallIdentifier, double> selfTimes;
+    for (ProfileNode* node = m_head->firstChild(); node; node = node->traverseNextNodePreOrder()) {
+        if (node->actualSelfTime())
+            selfTimes.add(node->callIdentifier(), 0).first->second += node->actualSelfTime();
+    }
+
+    Vector<CallIdentifierTimePair> functions;
+    functions.reserveCapacity(selfTimes.size());
+    HashMap<CallIdentifier, double>::const_iterator selfTimesEnd = selfTimes.end();
+    for (HashMap<CallIdentifier, double>::const_iterator it = selfTimes.begin(); it != selfTimesEnd; ++it)
+        functions.append(*it);
+    std::sort(functions.begin(), functions.end(), callIdentifierTimePairComparator);
+
+    fprintf(file, "#\n# self ms\tself %%\tfunction\turl:line\n");
+    for (size_t i = 0; i < functions.size(); ++i)
+        printFlatLine(file, functions[i].first, functions[i].second, totalTime);
+
+    if (m_sampledLines.isEmpty())
+        return;
+
+    Vector<CallIdentifierTimePair> lines;
+    lines.reserveCapacity(m_sampledLines.size());
+    HashMap<CallIdentifier, SampledLine>::const_iterator end = m_sampledLines.end();
+    for (HashMap<CallIdentifier, SampledLine>::const_iterator it = m_sampledLines.begin(); it != end; ++it)
+        lines.append(std::make_pair(it->first, it->second.time));
+    std::sort(lines.begin(), lines.end(), callIdentifierTimePairComparator);
+
+    fprintf(file, "#\n# sampled ms\tsampled %%\tfunction\turl:line\tsamples\n");
+    for (size_t i = 0; i < lines.size(); ++i) {
+        fprintf(file, "%.3f\t%.2f\t%s\t%s:%u\t%u\n", lines[i].second, totalTime ? lines[i].second / totalTime * 100.0 : 0.0,
+            lines[i].first.m_name.utf8().data(), lines[i].first.m_url.utf8().data(), lines[i].first.m_lineNumber,
+            m_sampledLines.get(lines[i].first).samples);
+    }
+}
+
 #ifndef NDEBUG
 void Profile::debugPrintData() const
 {
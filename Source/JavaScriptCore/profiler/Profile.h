@@ -28,6 +28,8 @@
 
 #include "ProfileNode.h"
 #include <runtime/UString.h>
+#include <stdio.h>
+#include <wtf/HashMap.h>
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
 
@@ -50,6 +52,14 @@ namespace JSC {
         void exclude(const ProfileNode*);
         void restoreAll();
 
+        // Sampled profiles also record the line each sample landed on, keyed by the
+        // function's name and URL with the sampled line in place of the function's.
+        void didSampleLine(const CallIdentifier& location, double time);
+
+        // Writes self times by function and, for sampled profiles, by line, as
+        // tab-separated text for offline tools.
+        void printFlatData(FILE*) const;
+
 #ifndef NDEBUG
         void debugPrintData() const;
         void debugPrintDataSampleStyle() const;
@@ -62,9 +72,21 @@ namespace JSC {
         void removeProfileStart();
         void removeProfileEnd();
  
+        struct SampledLine {
+            SampledLine()
+                : samples(0)
+                , time(0)
+            {
+            }
+
+            unsigned samples;
+            double time;
+        };
+
         UString m_title;
         RefPtr<ProfileNode> m_head;
         unsigned int m_uid;
+        HashMap<CallIdentifier, SampledLine> m_sampledLines;
     };
 
 } // namespace JSC
@@ -40,17 +40,26 @@ namespace JSC {
 
 static const char* NonJSExecution = "(idle)";
 
-PassRefPtr<ProfileGenerator> ProfileGenerator::create(ExecState* exec, const UString& title, unsigned uid)
+PassRefPtr<ProfileGenerator> ProfileGenerator::create(ExecState* exec, const UString& title, unsigned uid, ProfileType type)
 {
-    return adoptRef(new ProfileGenerator(exec, title, uid));
+    return adoptRef(new ProfileGenerator(exec, title, uid, type));
 }
 
-ProfileGenerator::ProfileGenerator(ExecState* exec, const UString& title, unsigned uid)
+ProfileGenerator::ProfileGenerator(ExecState* exec, const UString& title, unsigned uid, ProfileType type)
     : m_origin(exec ? exec->lexicalGlobalObject() : 0)
     , m_profileGroup(exec ? exec->lexicalGlobalObject()->profileGroup() : 0)
+    , m_type(type)
 {
     m_profile = Profile::create(title, uid);
     m_currentNode = m_head = m_profile->head();
+
+    // Samples carry whole stacks and times of their own, so the tree is not rooted
+    // at the caller and no node is ever timed.
+    if (m_type == Sampled) {
+        m_head->setStartTime(0.0);
+        return;
+    }
+
     if (exec)
         addParentForConsoleStart(exec);
 }
@@ -121,8 +130,42 @@ void ProfileGenerator::exceptionUnwind(ExecState* handlerCallFrame, const CallId
     }
 }
 
+void ProfileGenerator::didSample(const Vector<CallIdentifier, 32>& stack, const CallIdentifier& location, double time)
+{
+    ASSERT(m_type == Sampled);
+
+    ProfileNode* node = m_head.get();
+    node->setTotalTime(node->actualTotalTime() + time);
+
+    for (size_t i = stack.size(); i--; ) {
+        ProfileNode* child = 0;
+        const Vector<RefPtr<ProfileNode> >& children = node->children();
+        for (size_t j = 0; j < children.size(); ++j) {
+            if (children[j]->callIdentifier() == stack[i]) {
+                child = children[j].get();
+                break;
+            }
+        }
+        if (!child) {
+            RefPtr<ProfileNode> newChild = ProfileNode::create(0, stack[i], m_head.get(), node);
+            newChild->setStartTime(0.0);
+            node->addChild(newChild.release());
+            child = node->lastChild();
+        }
+
+        child->setTotalTime(child->actualTotalTime() + time);
+        node = child;
+    }
+
+    node->setSelfTime(node->actualSelfTime() + time);
+    m_profile->didSampleLine(location, time);
+}
+
 void ProfileGenerator::stopProfiling()
 {
+    if (m_type == Sampled)
+        return;
+
     m_profile->forEach(&ProfileNode::stopProfiling);
 
     removeProfileStart();
@@ -30,6 +30,7 @@
 #include <wtf/PassRefPtr.h>
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
 
 namespace JSC {
 
@@ -42,7 +43,9 @@ namespace JSC {
 
     class ProfileGenerator : public RefCounted<ProfileGenerator>  {
     public:
-        static PassRefPtr<ProfileGenerator> create(ExecState*, const UString& title, unsigned uid);
+        enum ProfileType { Instrumented, Sampled };
+
+        static PassRefPtr<ProfileGenerator> create(ExecState*, const UString& title, unsigned uid, ProfileType = Instrumented);
 
         // Members
         const UString& title() const;
@@ -56,13 +59,16 @@ namespace JSC {
 
         void exceptionUnwind(ExecState* handlerCallFrame, const CallIdentifier&);
 
+        // Charges time to a sampled stack, given innermost frame first.
+        void didSample(const Vector<CallIdentifier, 32>& stack, const CallIdentifier& location, double time);
+
         // Stopping Profiling
         void stopProfiling();
 
         typedef void (ProfileGenerator::*ProfileFunction)(ExecState* callerOrHandlerCallFrame, const CallIdentifier& callIdentifier);
 
     private:
-        ProfileGenerator(ExecState*, const UString& title, unsigned uid);
+        ProfileGenerator(ExecState*, const UString& title, unsigned uid, ProfileType);
         void addParentForConsoleStart(ExecState*);
 
         void removeProfileStart();
@@ -73,6 +79,7 @@ namespace JSC {
         unsigned m_profileGroup;
         RefPtr<ProfileNode> m_head;
         RefPtr<ProfileNode> m_currentNode;
+        ProfileType m_type;
     };
 
 } // namespace JSC
@@ -110,6 +110,99 @@ void Profiler::stopProfiling(JSGlobalObject* origin)
                 s_sharedEnabledProfilerReference = 0;
         }
     }
+
+    bool stoppedSampling = false;
+    for (ptrdiff_t i = m_samplingProfiles.size() - 1; i >= 0; --i) {
+        ProfileGenerator* profileGenerator = m_samplingProfiles[i].get();
+        if (profileGenerator->origin() == origin) {
+            profileGenerator->stopProfiling();
+            m_samplingProfiles.remove(i);
+            stoppedSampling = true;
+        }
+    }
+    if (stoppedSampling)
+        stopSamplingIfUnused(origin->globalData());
+}
+
+void Profiler::startSampling(ExecState* exec, const UString& title, double sampleInterval)
+{
+    ASSERT_ARG(title, !title.isNull());
+    ASSERT(exec);
+
+    JSGlobalObject* origin = exec->lexicalGlobalObject();
+    for (size_t i = 0; i < m_samplingProfiles.size(); ++i) {
+        ProfileGenerator* profileGenerator = m_samplingProfiles[i].get();
+        if (profileGenerator->origin() == origin && profileGenerator->title() == title)
+            return;
+    }
+
+    m_samplingProfiles.append(ProfileGenerator::create(exec, title, ++ProfilesUID, ProfileGenerator::Sampled));
+    exec->globalData().timeoutChecker.startSampling(sampleInterval);
+}
+
+PassRefPtr<Profile> Profiler::stopSampling(ExecState* exec, const UString& title)
+{
+    ASSERT(exec);
+
+    JSGlobalObject* origin = exec->lexicalGlobalObject();
+    for (ptrdiff_t i = m_samplingProfiles.size() - 1; i >= 0; --i) {
+        ProfileGenerator* profileGenerator = m_samplingProfiles[i].get();
+        if (profileGenerator->origin() == origin && (title.isNull() || profileGenerator->title() == title)) {
+            profileGenerator->stopProfiling();
+            RefPtr<Profile> returnProfile = profileGenerator->profile();
+
+            m_samplingProfiles.remove(i);
+            stopSamplingIfUnused(exec->globalData());
+
+            return returnProfile;
+        }
+    }
+
+    return 0;
+}
+
+void Profiler::stopSamplingIfUnused(JSGlobalData& globalData)
+{
+    for (size_t i = 0; i < m_samplingProfiles.size(); ++i) {
+        if (&m_samplingProfiles[i]->origin()->globalData() == &globalData)
+            return;
+    }
+    globalData.timeoutChecker.stopSampling();
+}
+
+void Profiler::didSample(ExecState* exec, unsigned bytecodeOffset)
+{
+    double sampleTime = exec->globalData().timeoutChecker.takeSample() * 1000.0;
+    if (m_samplingProfiles.isEmpty())
+        return;
+
+    // Walk out from the sampled frame; host functions that called back into JS appear
+    // in the stack too. The sampled line is only recorded for the innermost frame.
+    Vector<CallIdentifier, 32> stack;
+    CallIdentifier location;
+    for (CallFrame* frame = exec; frame; frame = frame->callerFrame()->removeHostCallFrameFlag()) {
+        CodeBlock* codeBlock = frame->codeBlock();
+        if (!codeBlock) {
+            if (frame->callee())
+                stack.append(createCallIdentifier(frame, frame->callee(), "", 0));
+            continue;
+        }
+
+        ScriptExecutable* executable = codeBlock->ownerExecutable();
+        if (codeBlock->codeType() == FunctionCode)
+            stack.append(createCallIdentifier(frame, frame->callee(), "", 0));
+        else
+            stack.append(createCallIdentifier(frame, JSValue(), executable->sourceURL(), executable->lineNo()));
+
+        if (frame == exec)
+            location = CallIdentifier(stack.last().m_name, stack.last().m_url, codeBlock->lineNumberForBytecodeOffset(bytecodeOffset));
+    }
+
+    unsigned profileGroup = exec->lexicalGlobalObject()->profileGroup();
+    for (size_t i = 0; i < m_samplingProfiles.size(); ++i) {
+        if (m_samplingProfiles[i]->profileGroup() == profileGroup)
+            m_samplingProfiles[i]->didSample(stack, location, sampleTime);
+    }
 }
 
 static inline void dispatchFunctionToProfiles(ExecState* callerOrHandlerCallFrame, const Vector<RefPtr<ProfileGenerator> >& profiles, ProfileGenerator::ProfileFunction function, const CallIdentifier& callIdentifier, unsigned currentProfileTargetGroup)
@@ -67,10 +67,19 @@ namespace JSC {
 
         void exceptionUnwind(ExecState* handlerCallFrame);
 
+        // Sampling profiles record the JS stack every sampleInterval seconds instead of
+        // instrumenting every call, and leave call counts at zero.
+        void startSampling(ExecState*, const UString& title, double sampleInterval = 0.001);
+        PassRefPtr<Profile> stopSampling(ExecState*, const UString& title);
+        void didSample(ExecState*, unsigned bytecodeOffset);
+
         const Vector<RefPtr<ProfileGenerator> >& currentProfiles() { return m_currentProfiles; };
 
     private:
+        void stopSamplingIfUnused(JSGlobalData&);
+
         Vector<RefPtr<ProfileGenerator> > m_currentProfiles;
+        Vector<RefPtr<ProfileGenerator> > m_samplingProfiles;
         static Profiler* s_sharedProfiler;
         static Profiler* s_sharedEnabledProfilerReference;
     };
@@ -267,7 +267,7 @@ JSObject* FunctionExecutable::compileForCallInternal(ExecState* exec, ScopeChain
             m_jitCodeForCall = JIT::compile(scopeChainNode->globalData, m_codeBlockForCall.get(), &m_jitCodeForCallWithArityCheck);
 
 #if !ENABLE(OPCODE_SAMPLING)
-        if (!BytecodeGenerator::dumpsGeneratedCode())
+        if (!BytecodeGenerator::dumpsGeneratedCode() && !m_codeBlockForCall->mayOptimizeLoops())
             m_codeBlockForCall->discardBytecode();
 #endif
     }
@@ -312,7 +312,7 @@ JSObject* FunctionExecutable::compileForConstructInternal(ExecState* exec, Scope
     if (exec->globalData().canUseJIT()) {
         m_jitCodeForConstruct = JIT::compile(scopeChainNode->globalData, m_codeBlockForConstruct.get(), &m_jitCodeForConstructWithArityCheck);
 #if !ENABLE(OPCODE_SAMPLING)
-        if (!BytecodeGenerator::dumpsGeneratedCode())
+        if (!BytecodeGenerator::dumpsGeneratedCode() && !m_codeBlockForConstruct->mayOptimizeLoops())
             m_codeBlockForConstruct->discardBytecode();
 #endif
     }
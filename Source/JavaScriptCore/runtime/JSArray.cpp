@@ -142,6 +142,7 @@ JSArray::JSArray(JSGlobalData& globalData, Structure* structure)
     m_storage->m_allocBase = m_storage;
     m_indexBias = 0;
     m_vectorLength = initialCapacity;
+    m_storage->m_indexingShape = ArrayWithInt32;
 
     checkConsistency();
 
@@ -164,6 +165,7 @@ JSArray::JSArray(JSGlobalData& globalData, Structure* structure, unsigned initia
     m_storage->m_length = initialLength;
     m_indexBias = 0;
     m_vectorLength = initialCapacity;
+    m_storage->m_indexingShape = ArrayWithInt32;
     m_storage->m_sparseValueMap = 0;
     m_storage->subclassData = 0;
     m_storage->reportedMapCapacity = 0;
@@ -210,6 +212,7 @@ JSArray::JSArray(JSGlobalData& globalData, Structure* structure, const ArgList&
     m_indexBias = 0;
     m_storage->m_length = initialCapacity;
     m_vectorLength = initialStorage;
+    m_storage->m_indexingShape = ArrayWithInt32;
     m_storage->m_numValuesInVector = initialCapacity;
     m_storage->m_sparseValueMap = 0;
     m_storage->subclassData = 0;
@@ -221,8 +224,10 @@ JSArray::JSArray(JSGlobalData& globalData, Structure* structure, const ArgList&
     size_t i = 0;
     WriteBarrier<Unknown>* vector = m_storage->m_vector;
     ArgList::const_iterator end = list.end();
-    for (ArgList::const_iterator it = list.begin(); it != end; ++it, ++i)
+    for (ArgList::const_iterator it = list.begin(); it != end; ++it, ++i) {
+        noteIndexedValue(*it);
         vector[i].set(globalData, this, *it);
+    }
     for (; i < initialStorage; i++)
         vector[i].clear();
 
@@ -353,6 +358,7 @@ void JSArray::put(ExecState* exec, unsigned i, JSValue value)
     }
 
     if (i < m_vectorLength) {
+        noteIndexedValue(value);
         WriteBarrier<Unknown>& valueSlot = storage->m_vector[i];
         if (valueSlot) {
             valueSlot.set(exec->globalData(), this, value);
@@ -387,6 +393,7 @@ NEVER_INLINE void JSArray::putSlowCase(ExecState* exec, unsigned i, JSValue valu
             if (!map) {
                 map = new SparseArrayValueMap;
                 storage->m_sparseValueMap = map;
+                storage->m_indexingShape = ArrayWithContiguous;
             }
 
             WriteBarrier<Unknown> temp;
@@ -409,6 +416,7 @@ NEVER_INLINE void JSArray::putSlowCase(ExecState* exec, unsigned i, JSValue valu
     if (!map || map->isEmpty()) {
         if (increaseVectorLength(i + 1)) {
             storage = m_storage;
+            noteIndexedValue(value);
             storage->m_vector[i].set(exec->globalData(), this, value);
             ++storage->m_numValuesInVector;
             checkConsistency();
@@ -471,6 +479,7 @@ NEVER_INLINE void JSArray::putSlowCase(ExecState* exec, unsigned i, JSValue valu
     m_vectorLength = newVectorLength;
     storage->m_numValuesInVector = newNumValuesInVector;
 
+    noteIndexedValue(value);
     storage->m_vector[i].set(exec->globalData(), this, value);
 
     checkConsistency();
@@ -737,6 +746,7 @@ void JSArray::push(ExecState* exec, JSValue value)
     ArrayStorage* storage = m_storage;
 
     if (storage->m_length < m_vectorLength) {
+        noteIndexedValue(value);
         storage->m_vector[storage->m_length].set(exec->globalData(), this, value);
         ++storage->m_numValuesInVector;
         ++storage->m_length;
@@ -749,6 +759,7 @@ void JSArray::push(ExecState* exec, JSValue value)
         if (!map || map->isEmpty()) {
             if (increaseVectorLength(storage->m_length + 1)) {
                 storage = m_storage;
+                noteIndexedValue(value);
                 storage->m_vector[storage->m_length].set(exec->globalData(), this, value);
                 ++storage->m_numValuesInVector;
                 ++storage->m_length;
@@ -1294,6 +1305,8 @@ void JSArray::checkConsistency(ConsistencyCheckType type)
             ASSERT(i < storage->m_length);
             if (type != DestructorConsistencyCheck)
                 value.isUndefined(); // Likely to crash if the object was deallocated.
+            ASSERT(storage->m_indexingShape != ArrayWithInt32 || value.isInt32());
+            ASSERT(storage->m_indexingShape != ArrayWithDouble || value.isNumber());
             ++numValuesInVector;
         } else {
             if (type == SortConsistencyCheck)
@@ -1304,6 +1317,7 @@ void JSArray::checkConsistency(ConsistencyCheckType type)
     ASSERT(numValuesInVector <= storage->m_length);
 
     if (storage->m_sparseValueMap) {
+        ASSERT(storage->m_indexingShape == ArrayWithContiguous);
         SparseArrayValueMap::iterator end = storage->m_sparseValueMap->end();
         for (SparseArrayValueMap::iterator it = storage->m_sparseValueMap->begin(); it != end; ++it) {
             unsigned index = it->first;
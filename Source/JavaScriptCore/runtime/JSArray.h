@@ -37,6 +37,7 @@ namespace JSC {
     struct ArrayStorage {
         unsigned m_length; // The "length" property on the array
         unsigned m_numValuesInVector;
+        unsigned m_indexingShape; // An ArrayIndexingShape; see below.
         SparseArrayValueMap* m_sparseValueMap;
         void* subclassData; // A JSArray subclass can use this to fill the vector lazily.
         void* m_allocBase; // Pointer to base address returned by malloc().  Keeping this pointer does eliminate false positives from the leak detector.
@@ -57,6 +58,19 @@ namespace JSC {
 
     enum ArrayCreationMode { CreateCompact, CreateInitialized };
 
+    // The indexing shape records the most general kind of value ever stored into an
+    // array's vector, so that the JIT and the collector can specialize on it:
+    //
+    //   - ArrayWithInt32: every value present in the vector is an int32.
+    //   - ArrayWithDouble: every value present in the vector is a number.
+    //   - ArrayWithContiguous: no restriction.
+    //
+    // Shapes are ordered by generality and only ever move towards ArrayWithContiguous;
+    // an array with a sparse value map is always ArrayWithContiguous. Because numbers
+    // are never cells, the vector of a numeric array does not need to be visited by
+    // the collector.
+    enum ArrayIndexingShape { ArrayWithInt32, ArrayWithDouble, ArrayWithContiguous };
+
     class JSArray : public JSNonFinalObject {
         friend class Walker;
 
@@ -107,6 +121,7 @@ namespace JSC {
                 if (i >= storage->m_length)
                     storage->m_length = i + 1;
             }
+            noteIndexedValue(v);
             x.set(globalData, this, v);
         }
         
@@ -117,9 +132,12 @@ namespace JSC {
 #if CHECK_ARRAY_CONSISTENCY
             ASSERT(storage->m_inCompactInitialization);
 #endif
+            noteIndexedValue(v);
             storage->m_vector[i].set(globalData, this, v);
         }
 
+        ArrayIndexingShape indexingShape() const { return static_cast<ArrayIndexingShape>(m_storage->m_indexingShape); }
+
         void fillArgList(ExecState*, MarkedArgumentBuffer&);
         void copyToRegisters(ExecState*, Register*, uint32_t);
 
@@ -161,6 +179,16 @@ namespace JSC {
         
         unsigned compactForSorting();
 
+        void noteIndexedValue(JSValue value)
+        {
+            ArrayStorage* storage = m_storage;
+            if (storage->m_indexingShape == ArrayWithContiguous)
+                return;
+            if (value.isInt32())
+                return;
+            storage->m_indexingShape = value.isNumber() ? ArrayWithDouble : ArrayWithContiguous;
+        }
+
         enum ConsistencyCheckType { NormalConsistencyCheck, DestructorConsistencyCheck, SortConsistencyCheck };
         void checkConsistency(ConsistencyCheckType = NormalConsistencyCheck);
 
@@ -191,6 +219,12 @@ namespace JSC {
         
         ArrayStorage* storage = m_storage;
 
+        // Numeric arrays hold no cells, and never have a sparse map.
+        if (storage->m_indexingShape != ArrayWithContiguous) {
+            ASSERT(!storage->m_sparseValueMap);
+            return;
+        }
+
         unsigned usedVectorLength = std::min(storage->m_length, m_vectorLength);
         markStack.appendValues(storage->m_vector, usedVectorLength, MayContainNullValues);
 
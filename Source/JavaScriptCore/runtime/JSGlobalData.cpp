@@ -169,6 +169,8 @@ JSGlobalData::JSGlobalData(GlobalDataType globalDataType, ThreadStackType thread
     , m_regExpCache(new RegExpCache(this))
 #if ENABLE(REGEXP_TRACING)
     , m_rtTraceList(new RTTraceList())
+    , m_rtJITCompileCount(0)
+    , m_rtInterpreterFallbackCount(0)
 #endif
 #ifndef NDEBUG
     , exclusiveThread(0)
@@ -430,8 +432,16 @@ void JSGlobalData::dumpRegExpTrace()
 
         printf("%d Regular Expressions\n", reCount);
     }
+
+    unsigned compileCount = m_rtJITCompileCount + m_rtInterpreterFallbackCount;
+    if (compileCount)
+        printf("%u of %u Regular Expression compilations fell back to the interpreter (%.1f%%)\n", m_rtInterpreterFallbackCount, compileCount, 100.0 * m_rtInterpreterFallbackCount / compileCount);
+
+    printf("RegExp cache: %u hits, %u misses\n", m_regExpCache->hitCount(), m_regExpCache->missCount());
     
     m_rtTraceList->clear();
+    m_rtJITCompileCount = 0;
+    m_rtInterpreterFallbackCount = 0;
 }
 #else
 void JSGlobalData::dumpRegExpTrace()
@@ -246,6 +246,8 @@ namespace JSC {
 #if ENABLE(REGEXP_TRACING)
         typedef ListHashSet<RefPtr<RegExp> > RTTraceList;
         RTTraceList* m_rtTraceList;
+        unsigned m_rtJITCompileCount;
+        unsigned m_rtInterpreterFallbackCount;
 #endif
 
 #ifndef NDEBUG
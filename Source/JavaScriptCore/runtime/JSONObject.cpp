@@ -128,6 +128,22 @@ private:
 
 // ------------------------------ helper functions --------------------------------
 
+// Integers are the most common numbers in JSON output; this avoids creating a string for each of them.
+static inline void appendInt32(UStringBuilder& builder, int32_t value)
+{
+    UChar buffer[11];
+    UChar* end = buffer + WTF_ARRAY_LENGTH(buffer);
+    UChar* p = end;
+    uint32_t magnitude = value < 0 ? -static_cast<uint32_t>(value) : value;
+    do {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude);
+    if (value < 0)
+        *--p = '-';
+    builder.append(p, end - p);
+}
+
 static inline JSValue unwrapBoxedPrimitive(ExecState* exec, JSValue value)
 {
     if (!value.isObject())
@@ -381,6 +397,11 @@ Stringifier::StringifyResult Stringifier::appendStringifiedValue(UStringBuilder&
         return StringifySucceeded;
     }
 
+    if (value.isInt32()) {
+        appendInt32(builder, value.asInt32());
+        return StringifySucceeded;
+    }
+
     double numericValue;
     if (value.getNumber(numericValue)) {
         if (!isfinite(numericValue))
@@ -486,9 +507,14 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, UStringBu
             m_size = m_object->get(exec, exec->globalData().propertyNames->length).toUInt32(exec);
             builder.append('[');
         } else {
+            Structure* structure = m_object->structure();
             if (stringifier.m_usingArrayReplacer)
                 m_propertyNames = stringifier.m_arrayReplacerPropertyNames.data();
-            else {
+            else if (structure->typeInfo().isFinal() && !structure->isDictionary() && !structure->hasGetterSetterProperties()) {
+                // Plain objects have no properties beyond those in their Structure, which
+                // lists them once for every object that shares it.
+                m_propertyNames = structure->enumerablePropertyNames(exec->globalData());
+            } else {
                 PropertyNameArray objectPropertyNames(exec);
                 m_object->getOwnPropertyNames(exec, objectPropertyNames);
                 m_propertyNames = objectPropertyNames.releaseData();
@@ -534,14 +560,20 @@ bool Stringifier::Holder::appendNextProperty(Stringifier& stringifier, UStringBu
         // Append the stringified value.
         stringifyResult = stringifier.appendStringifiedValue(builder, value, m_object.get(), index);
     } else {
-        // Get the value.
-        PropertySlot slot(m_object.get());
+        // Get the value. If the object still has the Structure the names came from,
+        // the value can be read straight from its storage.
         Identifier& propertyName = m_propertyNames->propertyNameVector()[index];
-        if (!m_object->getOwnPropertySlot(exec, propertyName, slot))
-            return true;
-        JSValue value = slot.getValue(exec, propertyName);
-        if (exec->hadException())
-            return false;
+        JSValue value;
+        if (m_object->structure()->cachedEnumerablePropertyNames() == m_propertyNames.get())
+            value = m_object->getDirectOffset(m_propertyNames->offsetVector()[index]);
+        else {
+            PropertySlot slot(m_object.get());
+            if (!m_object->getOwnPropertySlot(exec, propertyName, slot))
+                return true;
+            value = slot.getValue(exec, propertyName);
+            if (exec->hadException())
+                return false;
+        }
 
         rollBackPoint = builder.length();
 
@@ -245,6 +245,7 @@ namespace JSC {
         }
 
         static size_t offsetOfInlineStorage();
+        static size_t offsetOfPropertyStorage() { return OBJECT_OFFSETOF(JSObject, m_propertyStorage); }
         
         static JS_EXPORTDATA const ClassInfo s_info;
 
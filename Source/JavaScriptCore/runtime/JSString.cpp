@@ -138,7 +138,7 @@ JSString* JSString::substringFromRope(ExecState* exec, unsigned substringStart,
         if (copyStart == fiberStart && copyEnd == fiberEnd)
             substringFibers[substringFiberCount++] = UString(fiberString);
         else
-            substringFibers[substringFiberCount++] = UString(StringImpl::create(fiberString, copyStart - fiberStart, copyEnd - copyStart));
+            substringFibers[substringFiberCount++] = UString(StringImpl::createSubstringSharingImpl(fiberString, copyStart - fiberStart, copyEnd - copyStart));
         if (fiberEnd >= substringEnd)
             break;
         if (fiberCount > substringFromRopeCutoff || substringFiberCount >= 3) {
@@ -214,9 +214,75 @@ JSValue JSString::replaceCharacter(ExecState* exec, UChar character, const UStri
     return JSValue(new (globalData) JSString(globalData, builder.release()));
 }
 
+// A rope whose fibers are all plain strings can be read in place in a few steps,
+// so single character reads and searches on it do not need to flatten it.
+bool JSString::isShallowRope() const
+{
+    ASSERT(isRope());
+    for (unsigned i = 0; i < m_fiberCount; ++i) {
+        if (RopeImpl::isRope(m_other.m_fibers[i]))
+            return false;
+    }
+    return true;
+}
+
+// Returns the fiber of a shallow rope holding the given character, and rebases
+// the index to be relative to the start of that fiber.
+StringImpl* JSString::fiberForIndex(unsigned& index) const
+{
+    ASSERT(isShallowRope());
+    ASSERT(index < m_length);
+    for (unsigned i = 0; i < m_fiberCount; ++i) {
+        StringImpl* string = static_cast<StringImpl*>(m_other.m_fibers[i]);
+        if (index < string->length())
+            return string;
+        index -= string->length();
+    }
+    ASSERT_NOT_REACHED();
+    return 0;
+}
+
+UChar JSString::characterAt(ExecState* exec, unsigned i)
+{
+    ASSERT(i < m_length);
+    if (isRope()) {
+        if (isShallowRope()) {
+            StringImpl* string = fiberForIndex(i);
+            return (*string)[i];
+        }
+        resolveRope(exec);
+        if (exec->exception())
+            return 0;
+    }
+    return m_value.characters()[i];
+}
+
+size_t JSString::find(ExecState* exec, UChar character, unsigned start)
+{
+    if (!isRope() || !isShallowRope())
+        return value(exec).find(character, start);
+
+    unsigned fiberStart = 0;
+    for (unsigned i = 0; i < m_fiberCount; ++i) {
+        StringImpl* string = static_cast<StringImpl*>(m_other.m_fibers[i]);
+        unsigned fiberEnd = fiberStart + string->length();
+        if (start < fiberEnd) {
+            size_t position = string->find(character, start > fiberStart ? start - fiberStart : 0);
+            if (position != notFound)
+                return fiberStart + position;
+        }
+        fiberStart = fiberEnd;
+    }
+    return notFound;
+}
+
 JSString* JSString::getIndexSlowCase(ExecState* exec, unsigned i)
 {
     ASSERT(isRope());
+    if (isShallowRope()) {
+        StringImpl* string = fiberForIndex(i);
+        return jsSingleCharacterSubstring(exec, UString(string), i);
+    }
     resolveRope(exec);
     // Return a safe no-value result, this should never be used, since the excetion will be thrown.
     if (exec->exception())
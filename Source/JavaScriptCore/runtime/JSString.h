@@ -347,6 +347,10 @@ namespace JSC {
         JSString* getIndex(ExecState*, unsigned);
         JSString* getIndexSlowCase(ExecState*, unsigned);
 
+        // These read a rope of plain strings in place; deeper ropes are resolved first.
+        UChar characterAt(ExecState*, unsigned);
+        size_t find(ExecState*, UChar, unsigned start);
+
         JSValue replaceCharacter(ExecState*, UChar, const UString& replacement);
 
         static Structure* createStructure(JSGlobalData& globalData, JSValue proto) { return Structure::create(globalData, proto, TypeInfo(StringType, OverridesGetOwnPropertySlot | NeedsThisConversion), AnonymousSlotCount, 0); }
@@ -360,6 +364,8 @@ namespace JSC {
 
         void resolveRope(ExecState*) const;
         JSString* substringFromRope(ExecState*, unsigned offset, unsigned length);
+        bool isShallowRope() const;
+        StringImpl* fiberForIndex(unsigned& index) const;
 
         void appendStringInConstruct(unsigned& index, const UString& string)
         {
@@ -550,7 +556,7 @@ namespace JSC {
             if (c <= maxSingleCharacterString)
                 return globalData->smallStrings.singleCharacterString(globalData, c);
         }
-        return fixupVPtr(globalData, new (globalData) JSString(globalData, UString(StringImpl::create(s.impl(), offset, length)), JSString::HasOtherOwner));
+        return fixupVPtr(globalData, new (globalData) JSString(globalData, UString(StringImpl::createSubstringSharingImpl(s.impl(), offset, length))));
     }
 
     inline JSString* jsOwnedString(JSGlobalData* globalData, const UString& s)
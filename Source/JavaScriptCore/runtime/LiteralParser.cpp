@@ -141,73 +141,86 @@ template <LiteralParser::ParserMode mode> static inline bool isSafeStringCharact
 template <LiteralParser::ParserMode mode> inline LiteralParser::TokenType LiteralParser::Lexer::lexString(LiteralParserToken& token)
 {
     ++m_ptr;
-    const UChar* runStart;
+    const UChar* runStart = m_ptr;
+    while (m_ptr < m_end && isSafeStringCharacter<mode>(*m_ptr))
+        ++m_ptr;
+    if (m_ptr < m_end && *m_ptr == '"') {
+        token.stringToken = UString();
+        token.stringStart = runStart;
+        token.stringLength = m_ptr - runStart;
+        token.type = TokString;
+        token.end = ++m_ptr;
+        return TokString;
+    }
+
     UStringBuilder builder;
-    do {
-        runStart = m_ptr;
-        while (m_ptr < m_end && isSafeStringCharacter<mode>(*m_ptr))
-            ++m_ptr;
+    while (true) {
         if (runStart < m_ptr)
             builder.append(runStart, m_ptr - runStart);
-        if ((mode == StrictJSON) && m_ptr < m_end && *m_ptr == '\\') {
-            ++m_ptr;
-            if (m_ptr >= m_end)
-                return TokError;
-            switch (*m_ptr) {
-                case '"':
-                    builder.append('"');
-                    m_ptr++;
-                    break;
-                case '\\':
-                    builder.append('\\');
-                    m_ptr++;
-                    break;
-                case '/':
-                    builder.append('/');
-                    m_ptr++;
-                    break;
-                case 'b':
-                    builder.append('\b');
-                    m_ptr++;
-                    break;
-                case 'f':
-                    builder.append('\f');
-                    m_ptr++;
-                    break;
-                case 'n':
-                    builder.append('\n');
-                    m_ptr++;
-                    break;
-                case 'r':
-                    builder.append('\r');
-                    m_ptr++;
-                    break;
-                case 't':
-                    builder.append('\t');
-                    m_ptr++;
-                    break;
+        if (mode != StrictJSON || m_ptr >= m_end || *m_ptr != '\\')
+            break;
+        ++m_ptr;
+        if (m_ptr >= m_end)
+            return TokError;
+        switch (*m_ptr) {
+            case '"':
+                builder.append('"');
+                m_ptr++;
+                break;
+            case '\\':
+                builder.append('\\');
+                m_ptr++;
+                break;
+            case '/':
+                builder.append('/');
+                m_ptr++;
+                break;
+            case 'b':
+                builder.append('\b');
+                m_ptr++;
+                break;
+            case 'f':
+                builder.append('\f');
+                m_ptr++;
+                break;
+            case 'n':
+                builder.append('\n');
+                m_ptr++;
+                break;
+            case 'r':
+                builder.append('\r');
+                m_ptr++;
+                break;
+            case 't':
+                builder.append('\t');
+                m_ptr++;
+                break;
 
-                case 'u':
-                    if ((m_end - m_ptr) < 5) // uNNNN == 5 characters
+            case 'u':
+                if ((m_end - m_ptr) < 5) // uNNNN == 5 characters
+                    return TokError;
+                for (int i = 1; i < 5; i++) {
+                    if (!isASCIIHexDigit(m_ptr[i]))
                         return TokError;
-                    for (int i = 1; i < 5; i++) {
-                        if (!isASCIIHexDigit(m_ptr[i]))
-                            return TokError;
-                    }
-                    builder.append(JSC::Lexer::convertUnicode(m_ptr[1], m_ptr[2], m_ptr[3], m_ptr[4]));
-                    m_ptr += 5;
-                    break;
+                }
+                builder.append(JSC::Lexer::convertUnicode(m_ptr[1], m_ptr[2], m_ptr[3], m_ptr[4]));
+                m_ptr += 5;
+                break;
 
-                default:
-                    return TokError;
-            }
+            default:
+                return TokError;
         }
-    } while ((mode == StrictJSON) && m_ptr != runStart && (m_ptr < m_end) && *m_ptr != '"');
+        runStart = m_ptr;
+        while (m_ptr < m_end && isSafeStringCharacter<mode>(*m_ptr))
+            ++m_ptr;
+    }
 
     if (m_ptr >= m_end || *m_ptr != '"')
         return TokError;
 
     token.stringToken = builder.toUString();
+    token.stringStart = token.stringToken.characters();
+    token.stringLength = token.stringToken.length();
     token.type = TokString;
     token.end = ++m_ptr;
     return TokString;
@@ -274,6 +287,22 @@ LiteralParser::TokenType LiteralParser::Lexer::lexNumber(LiteralParserToken& tok
     
     token.type = TokNumber;
     token.end = m_ptr;
+
+    // Short integers are by far the most common numbers in JSON, and need no rounding.
+    const UChar* digit = token.start;
+    bool negative = *digit == '-';
+    if (negative)
+        ++digit;
+    if (m_ptr - digit <= 9) {
+        int result = 0;
+        for (; digit < m_ptr && isASCIIDigit(*digit); ++digit)
+            result = result * 10 + (*digit - '0');
+        if (digit == m_ptr) {
+            token.numberToken = negative ? -static_cast<double>(result) : result;
+            return TokNumber;
+        }
+    }
+
     Vector<char, 64> buffer(token.end - token.start + 1);
     int i;
     for (i = 0; i < token.end - token.start; i++) {
@@ -287,10 +316,41 @@ LiteralParser::TokenType LiteralParser::Lexer::lexNumber(LiteralParserToken& tok
     return TokNumber;
 }
 
+Identifier LiteralParser::makeIdentifier(const Lexer::LiteralParserToken& token)
+{
+    const UChar* characters = token.stringStart;
+    unsigned length = token.stringLength;
+    if (!length)
+        return Identifier(m_exec, characters, length);
+
+    Identifier& cached = m_recentIdentifiers[(characters[0] + characters[length - 1] + length) & (recentIdentifierCacheSize - 1)];
+    if (cached.isNull() || cached.length() != static_cast<int>(length) || memcmp(cached.characters(), characters, length * sizeof(UChar))) {
+        if (token.stringToken.isNull())
+            cached = Identifier(m_exec, characters, length);
+        else
+            cached = Identifier(m_exec, token.stringToken);
+    }
+    return cached;
+}
+
+JSValue LiteralParser::makeJSString(const Lexer::LiteralParserToken& token)
+{
+    if (token.stringToken.isNull()) {
+        if (token.stringLength == 1 && token.stringStart[0] <= maxSingleCharacterString)
+            return jsSingleCharacterString(m_exec, token.stringStart[0]);
+        return jsString(m_exec, UString(token.stringStart, token.stringLength));
+    }
+    return jsString(m_exec, token.stringToken);
+}
+
 JSValue LiteralParser::parse(ParserState initialState)
 {
     ParserState state = initialState;
     MarkedArgumentBuffer objectStack;
+    // The elements of the arrays being parsed; each array is only created once
+    // all of its elements are known, so that its storage is allocated just once.
+    MarkedArgumentBuffer arrayElements;
+    Vector<unsigned, 16> arrayStartStack;
     JSValue lastValue;
     Vector<ParserState, 16> stateStack;
     Vector<Identifier, 16> identifierStack;
@@ -298,8 +358,7 @@ JSValue LiteralParser::parse(ParserState initialState)
         switch(state) {
             startParseArray:
             case StartParseArray: {
-                JSArray* array = constructEmptyArray(m_exec);
-                objectStack.append(array);
+                arrayStartStack.append(arrayElements.size());
                 // fallthrough
             }
             doParseArrayStartExpression:
@@ -309,8 +368,8 @@ JSValue LiteralParser::parse(ParserState initialState)
                     if (lastToken == TokComma)
                         return JSValue();
                     m_lexer.next();
-                    lastValue = objectStack.last();
-                    objectStack.removeLast();
+                    arrayStartStack.removeLast();
+                    lastValue = constructEmptyArray(m_exec);
                     break;
                 }
 
@@ -318,8 +377,8 @@ JSValue LiteralParser::parse(ParserState initialState)
                 goto startParseExpression;
             }
             case DoParseArrayEndExpression: {
-                 asArray(objectStack.last())->push(m_exec, lastValue);
-                
+                arrayElements.append(lastValue);
+
                 if (m_lexer.currentToken().type == TokComma)
                     goto doParseArrayStartExpression;
 
@@ -327,8 +386,11 @@ JSValue LiteralParser::parse(ParserState initialState)
                     return JSValue();
                 
                 m_lexer.next();
-                lastValue = objectStack.last();
-                objectStack.removeLast();
+                unsigned arrayStart = arrayStartStack.last();
+                arrayStartStack.removeLast();
+                lastValue = constructArray(m_exec, ArgList(arrayElements.begin() + arrayStart, arrayElements.size() - arrayStart));
+                while (arrayElements.size() > arrayStart)
+                    arrayElements.removeLast();
                 break;
             }
             startParseObject:
@@ -345,7 +407,7 @@ JSValue LiteralParser::parse(ParserState initialState)
                         return JSValue();
                     
                     m_lexer.next();
-                    identifierStack.append(Identifier(m_exec, identifierToken.stringToken));
+                    identifierStack.append(makeIdentifier(identifierToken));
                     stateStack.append(DoParseObjectEndExpression);
                     goto startParseExpression;
                 } else if (type != TokRBrace) 
@@ -367,7 +429,7 @@ JSValue LiteralParser::parse(ParserState initialState)
                     return JSValue();
 
                 m_lexer.next();
-                identifierStack.append(Identifier(m_exec, identifierToken.stringToken));
+                identifierStack.append(makeIdentifier(identifierToken));
                 stateStack.append(DoParseObjectEndExpression);
                 goto startParseExpression;
             }
@@ -394,7 +456,7 @@ JSValue LiteralParser::parse(ParserState initialState)
                     case TokString: {
                         Lexer::LiteralParserToken stringToken = m_lexer.currentToken();
                         m_lexer.next();
-                        lastValue = jsString(m_exec, stringToken.stringToken);
+                        lastValue = makeJSString(stringToken);
                         break;
                     }
                     case TokNumber: {
@@ -26,6 +26,7 @@
 #ifndef LiteralParser_h
 #define LiteralParser_h
 
+#include "Identifier.h"
 #include "JSGlobalObjectFunctions.h"
 #include "JSValue.h"
 #include "UString.h"
@@ -66,7 +67,11 @@ namespace JSC {
                 TokenType type;
                 const UChar* start;
                 const UChar* end;
+                // Strings without escapes are not copied out of the source; stringToken
+                // is only set when the string had to be unescaped.
                 UString stringToken;
+                const UChar* stringStart;
+                unsigned stringLength;
                 double numberToken;
             };
             Lexer(const UString& s, ParserMode mode)
@@ -100,10 +105,16 @@ namespace JSC {
         
         class StackGuard;
         JSValue parse(ParserState);
+        Identifier makeIdentifier(const Lexer::LiteralParserToken&);
+        JSValue makeJSString(const Lexer::LiteralParserToken&);
 
         ExecState* m_exec;
         LiteralParser::Lexer m_lexer;
         ParserMode m_mode;
+        // Objects in JSON data tend to repeat the same keys, so the identifiers for
+        // recently seen keys are kept to avoid creating and atomizing them again.
+        static const unsigned recentIdentifierCacheSize = 64;
+        Identifier m_recentIdentifiers[recentIdentifierCacheSize];
     };
 }
 
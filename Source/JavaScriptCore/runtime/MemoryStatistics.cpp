@@ -39,8 +39,12 @@ GlobalMemoryStatistics globalMemoryStatistics()
     stats.stackBytes = RegisterFile::committedByteCount();
 #if ENABLE(EXECUTABLE_ALLOCATOR_FIXED)
     stats.JITBytes = ExecutableAllocator::committedByteCount();
+    stats.JITPeakBytes = ExecutableAllocator::peakCommittedByteCount();
+    stats.JITAllocationFailures = ExecutableAllocator::failedAllocationCount();
 #else
     stats.JITBytes = 0;
+    stats.JITPeakBytes = 0;
+    stats.JITAllocationFailures = 0;
 #endif
     return stats;
 }
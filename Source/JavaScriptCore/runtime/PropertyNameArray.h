@@ -36,17 +36,23 @@ namespace JSC {
     class PropertyNameArrayData : public RefCounted<PropertyNameArrayData> {
     public:
         typedef Vector<Identifier, 20> PropertyNameVector;
+        typedef Vector<unsigned> OffsetVector;
 
         static PassRefPtr<PropertyNameArrayData> create() { return adoptRef(new PropertyNameArrayData); }
 
         PropertyNameVector& propertyNameVector() { return m_propertyNameVector; }
 
+        // Only filled in for names taken from a Structure (see Structure::enumerablePropertyNames),
+        // in which case it holds the storage offset of each property.
+        OffsetVector& offsetVector() { return m_offsetVector; }
+
     private:
         PropertyNameArrayData()
         {
         }
 
         PropertyNameVector m_propertyNameVector;
+        OffsetVector m_offsetVector;
     };
 
     // FIXME: Rename to PropertyNameArrayBuilder.
@@ -102,7 +102,14 @@ PassRefPtr<RegExp> RegExp::create(JSGlobalData* globalData, const UString& patte
 
 RegExp::RegExpState RegExp::compile(JSGlobalData* globalData)
 {
-    Yarr::YarrPattern pattern(m_patternString, ignoreCase(), multiline(), &m_constructionError);
+    bool useJIT = false;
+#if ENABLE(YARR_JIT)
+    // Under memory pressure leave the remaining executable memory to the
+    // function JITs, which have no interpreter to fall back to.
+    useJIT = globalData->canUseJIT() && !ExecutableAllocator::underMemoryPressure();
+#endif
+
+    Yarr::YarrPattern pattern(m_patternString, ignoreCase(), multiline(), &m_constructionError, useJIT);
     if (m_constructionError)
         return ParseError;
 
@@ -111,8 +118,14 @@ RegExp::RegExpState RegExp::compile(JSGlobalData* globalData)
     RegExpState res = ByteCode;
 
 #if ENABLE(YARR_JIT)
-    if (!pattern.m_containsBackreferences && globalData->canUseJIT()) {
+    if (useJIT) {
         Yarr::jitCompile(pattern, globalData, m_representation->m_regExpJITCode);
+#if ENABLE(REGEXP_TRACING)
+        if (!m_representation->m_regExpJITCode.isFallBack())
+            globalData->m_rtJITCompileCount++;
+        else
+            globalData->m_rtInterpreterFallbackCount++;
+#endif
 #if ENABLE(YARR_JIT_DEBUG)
         if (!m_representation->m_regExpJITCode.isFallBack())
             res = JITCode;
@@ -125,11 +138,27 @@ RegExp::RegExpState RegExp::compile(JSGlobalData* globalData)
     }
 #endif
 
-    m_representation->m_regExpBytecode = Yarr::byteCompile(pattern, &globalData->m_regExpAllocator);
+    if (useJIT) {
+        // The JIT's pattern has unrolled parentheses, and the JIT reorders terms in place. The
+        // interpreter cannot follow the input positions of either, so it gets a fresh pattern.
+        Yarr::YarrPattern interpreterPattern(m_patternString, ignoreCase(), multiline(), &m_constructionError);
+        ASSERT(!m_constructionError);
+        m_representation->m_regExpBytecode = Yarr::byteCompile(interpreterPattern, &globalData->m_regExpAllocator);
+    } else
+        m_representation->m_regExpBytecode = Yarr::byteCompile(pattern, &globalData->m_regExpAllocator);
 
     return res;
 }
 
+size_t RegExp::compiledCodeSize() const
+{
+#if ENABLE(YARR_JIT)
+    if (m_state == JITCode)
+        return m_representation->m_regExpJITCode.size();
+#endif
+    return 0;
+}
+
 int RegExp::match(const UString& s, int startOffset, Vector<int, 32>* ovector)
 {
     if (startOffset < 0)
@@ -254,7 +283,7 @@ void RegExp::matchCompareWithInterpreter(const UString& s, int startOffset, int*
 
         const size_t jitAddrSize = 20;
         char jitAddr[jitAddrSize];
-        if (m_state == JITCode)
+        if (m_state != JITCode)
             snprintf(jitAddr, jitAddrSize, "fallback");
         else
             snprintf(jitAddr, jitAddrSize, "0x%014lx", reinterpret_cast<unsigned long int>(codeBlock.getAddr()));
@@ -40,6 +40,7 @@ namespace JSC {
         static PassRefPtr<RegExp> create(JSGlobalData* globalData, const UString& pattern, RegExpFlags);
         ~RegExp();
 
+        RegExpFlags flags() const { return m_flags; }
         bool global() const { return m_flags & FlagGlobal; }
         bool ignoreCase() const { return m_flags & FlagIgnoreCase; }
         bool multiline() const { return m_flags & FlagMultiline; }
@@ -51,6 +52,9 @@ namespace JSC {
 
         int match(const UString&, int startOffset, Vector<int, 32>* ovector = 0);
         unsigned numSubpatterns() const { return m_numSubpatterns; }
+
+        // The size of the machine code generated for this pattern, if any.
+        size_t compiledCodeSize() const;
         
 #if ENABLE(REGEXP_TRACING)
         void printTraceData();
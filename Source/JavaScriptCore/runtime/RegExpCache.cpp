@@ -35,9 +35,14 @@ PassRefPtr<RegExp> RegExpCache::lookupOrCreate(const UString& patternString, Reg
 {
     if (patternString.length() < maxCacheablePatternLength) {
         pair<RegExpCacheMap::iterator, bool> result = m_cacheMap.add(RegExpKey(flags, patternString), 0);
-        if (!result.second)
+        if (!result.second) {
+            ++m_hitCount;
+            // Move the key to the most recently used end of the list.
+            RegExpKey key = result.first->first;
+            m_recentlyUsedKeys.remove(key);
+            m_recentlyUsedKeys.add(key);
             return result.first->second;
-        else
+        } else
             return create(patternString, flags, result.first);
     }
     return create(patternString, flags, m_cacheMap.end());
@@ -45,6 +50,7 @@ PassRefPtr<RegExp> RegExpCache::lookupOrCreate(const UString& patternString, Reg
 
 PassRefPtr<RegExp> RegExpCache::create(const UString& patternString, RegExpFlags flags, RegExpCacheMap::iterator iterator) 
 {
+    ++m_missCount;
     RefPtr<RegExp> regExp = RegExp::create(m_globalData, patternString, flags);
 
     if (patternString.length() >= maxCacheablePatternLength)
@@ -53,24 +59,30 @@ PassRefPtr<RegExp> RegExpCache::create(const UString& patternString, RegExpFlags
     RegExpKey key = RegExpKey(flags, patternString);
     iterator->first = key;
     iterator->second = regExp;
+    m_recentlyUsedKeys.add(key);
+    m_codeSize += regExp->compiledCodeSize();
 
-    ++m_nextKeyToEvict;
-    if (m_nextKeyToEvict == maxCacheableEntries) {
-        m_nextKeyToEvict = 0;
-        m_isFull = true;
-    }
-    if (m_isFull)
-        m_cacheMap.remove(RegExpKey(patternKeyArray[m_nextKeyToEvict].flagsValue, patternKeyArray[m_nextKeyToEvict].pattern));
-
-    patternKeyArray[m_nextKeyToEvict].flagsValue = key.flagsValue;
-    patternKeyArray[m_nextKeyToEvict].pattern = patternString.impl();
+    while (m_recentlyUsedKeys.size() > maxCacheableEntries || (m_codeSize > maxCacheableCodeSize && m_recentlyUsedKeys.size() > 1))
+        evictLeastRecentlyUsed();
     return regExp;
 }
 
+void RegExpCache::evictLeastRecentlyUsed()
+{
+    ListHashSet<RegExpKey>::iterator leastRecentlyUsed = m_recentlyUsedKeys.begin();
+    RegExpCacheMap::iterator iterator = m_cacheMap.find(*leastRecentlyUsed);
+    ASSERT(iterator != m_cacheMap.end());
+
+    m_codeSize -= iterator->second->compiledCodeSize();
+    m_cacheMap.remove(iterator);
+    m_recentlyUsedKeys.remove(leastRecentlyUsed);
+}
+
 RegExpCache::RegExpCache(JSGlobalData* globalData)
-    : m_globalData(globalData)
-    , m_nextKeyToEvict(-1)
-    , m_isFull(false)
+    : m_codeSize(0)
+    , m_globalData(globalData)
+    , m_hitCount(0)
+    , m_missCount(0)
 {
 }
 
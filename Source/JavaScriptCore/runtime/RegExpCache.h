@@ -28,8 +28,8 @@
 #include "RegExp.h"
 #include "RegExpKey.h"
 #include "UString.h"
-#include <wtf/FixedArray.h>
 #include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
 
 #ifndef RegExpCache_h
 #define RegExpCache_h
@@ -45,22 +45,32 @@ public:
     PassRefPtr<RegExp> create(const UString& patternString, RegExpFlags, RegExpCacheMap::iterator);
     RegExpCache(JSGlobalData* globalData);
 
+    unsigned hitCount() const { return m_hitCount; }
+    unsigned missCount() const { return m_missCount; }
+
 private:
+    void evictLeastRecentlyUsed();
+
     static const unsigned maxCacheablePatternLength = 256;
 
 #if PLATFORM(IOS)
     // The RegExpCache can currently hold onto multiple Mb of memory;
     // as a short-term fix some embedded platforms may wish to reduce the cache size.
     static const int maxCacheableEntries = 32;
+    static const size_t maxCacheableCodeSize = 64 * 1024;
 #else
     static const int maxCacheableEntries = 256;
+    static const size_t maxCacheableCodeSize = 512 * 1024;
 #endif
 
-    FixedArray<RegExpKey, maxCacheableEntries> patternKeyArray;
     RegExpCacheMap m_cacheMap;
+    // The keys of m_cacheMap, least recently used first.
+    ListHashSet<RegExpKey> m_recentlyUsedKeys;
+    // The total compiledCodeSize() of the cached patterns.
+    size_t m_codeSize;
     JSGlobalData* m_globalData;
-    int m_nextKeyToEvict;
-    bool m_isFull;
+    unsigned m_hitCount;
+    unsigned m_missCount;
 };
 
 } // namespace JSC
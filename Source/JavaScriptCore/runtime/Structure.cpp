@@ -580,6 +580,7 @@ Structure* Structure::flattenDictionaryStructure(JSGlobalData& globalData, JSObj
 size_t Structure::addPropertyWithoutTransition(JSGlobalData& globalData, const Identifier& propertyName, unsigned attributes, JSCell* specificValue)
 {
     ASSERT(!m_enumerationCache);
+    m_enumerablePropertyNames.clear();
 
     if (m_specificFunctionThrashCount == maxSpecificFunctionThrashCount)
         specificValue = 0;
@@ -765,6 +766,28 @@ void Structure::getPropertyNames(JSGlobalData& globalData, PropertyNameArray& pr
     }
 }
 
+PropertyNameArrayData* Structure::enumerablePropertyNames(JSGlobalData& globalData)
+{
+    ASSERT(!isDictionary());
+    if (m_enumerablePropertyNames)
+        return m_enumerablePropertyNames.get();
+
+    PropertyNameArray propertyNames(&globalData);
+    materializePropertyMapIfNecessary(globalData);
+    if (m_propertyTable) {
+        PropertyNameArrayData::OffsetVector& offsets = propertyNames.data()->offsetVector();
+        PropertyTable::iterator end = m_propertyTable->end();
+        for (PropertyTable::iterator iter = m_propertyTable->begin(); iter != end; ++iter) {
+            if (iter->attributes & DontEnum)
+                continue;
+            propertyNames.addKnownUnique(iter->key);
+            offsets.append(iter->offset);
+        }
+    }
+    m_enumerablePropertyNames = propertyNames.releaseData();
+    return m_enumerablePropertyNames.get();
+}
+
 void Structure::markChildren(MarkStack& markStack)
 {
     JSCell::markChildren(markStack);
@@ -132,6 +132,10 @@ namespace JSC {
         void setEnumerationCache(JSGlobalData&, JSPropertyNameIterator* enumerationCache); // Defined in JSPropertyNameIterator.h.
         JSPropertyNameIterator* enumerationCache(); // Defined in JSPropertyNameIterator.h.
         void getPropertyNames(JSGlobalData&, PropertyNameArray&, EnumerationMode mode);
+        // The enumerable properties in property table order, with their storage offsets.
+        // Only available for non-dictionary Structures; built on first use.
+        PropertyNameArrayData* enumerablePropertyNames(JSGlobalData&);
+        PropertyNameArrayData* cachedEnumerablePropertyNames() const { return m_enumerablePropertyNames.get(); }
 
         const ClassInfo* classInfo() const { return m_classInfo; }
 
@@ -221,6 +225,7 @@ namespace JSC {
         StructureTransitionTable m_transitionTable;
 
         WriteBarrier<JSPropertyNameIterator> m_enumerationCache;
+        RefPtr<PropertyNameArrayData> m_enumerablePropertyNames;
 
         OwnPtr<PropertyTable> m_propertyTable;
 
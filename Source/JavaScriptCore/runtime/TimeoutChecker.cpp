@@ -33,12 +33,12 @@
 #include "CallFrame.h"
 #include "JSGlobalObject.h"
 
+#include "CurrentTime.h"
+
 #if OS(DARWIN)
 #include <mach/mach.h>
 #elif OS(WINDOWS)
 #include <windows.h>
-#else
-#include "CurrentTime.h"
 #endif
 
 #if PLATFORM(BREWMP)
@@ -55,6 +55,14 @@ static const int ticksUntilFirstCheck = 1024;
 // Number of milliseconds between each timeout check.
 static const int intervalBetweenChecks = 1000;
 
+// Bounds on the number of ticks between checks while sampling.
+static const unsigned minimumTicksBetweenSamples = 16;
+static const unsigned maximumTicksBetweenSamples = 1 << 20;
+
+// Longest time, in sample intervals, that a single sample can account for; anything
+// longer was most likely spent outside JS.
+static const double maximumSampleIntervals = 4;
+
 // Returns the time the current thread has spent executing, in milliseconds.
 static inline unsigned getCPUTime()
 {
@@ -108,6 +116,9 @@ static inline unsigned getCPUTime()
 TimeoutChecker::TimeoutChecker()
     : m_timeoutInterval(0)
     , m_startCount(0)
+    , m_sampleInterval(0)
+    , m_timeAtLastSample(0)
+    , m_ticksUntilNextSample(ticksUntilFirstCheck)
 {
     reset();
 }
@@ -117,10 +128,20 @@ void TimeoutChecker::reset()
     m_ticksUntilNextCheck = ticksUntilFirstCheck;
     m_timeAtLastCheck = 0;
     m_timeExecuting = 0;
+    m_ticksSinceLastCheck = 0;
 }
 
 bool TimeoutChecker::didTimeOut(ExecState* exec)
 {
+    if (m_sampleInterval) {
+        // Most checks made while sampling come early; only evaluate the timeout once
+        // the ticks handed out since the last evaluation add up to a normal interval.
+        m_ticksSinceLastCheck += m_ticksUntilNextSample;
+        if (m_ticksSinceLastCheck < m_ticksUntilNextCheck)
+            return false;
+        m_ticksSinceLastCheck = 0;
+    }
+
     unsigned currentTime = getCPUTime();
     
     if (!m_timeAtLastCheck) {
@@ -155,4 +176,41 @@ bool TimeoutChecker::didTimeOut(ExecState* exec)
     return false;
 }
 
+void TimeoutChecker::startSampling(double sampleInterval)
+{
+    ASSERT(sampleInterval > 0);
+    m_sampleInterval = sampleInterval;
+    m_timeAtLastSample = currentTime();
+    m_ticksUntilNextSample = ticksUntilFirstCheck;
+    m_ticksSinceLastCheck = 0;
+}
+
+void TimeoutChecker::stopSampling()
+{
+    m_sampleInterval = 0;
+}
+
+bool TimeoutChecker::isSampleDue() const
+{
+    return m_sampleInterval && currentTime() - m_timeAtLastSample >= m_sampleInterval;
+}
+
+double TimeoutChecker::takeSample()
+{
+    ASSERT(m_sampleInterval);
+
+    double now = currentTime();
+    double elapsed = now - m_timeAtLastSample;
+    m_timeAtLastSample = now;
+
+    // Aim the next check at the sample interval, moving by at most a factor of two
+    // so that one slow or fast interval doesn't throw the rate off.
+    double scale = elapsed > 0 ? m_sampleInterval / elapsed : 2;
+    scale = max(0.5, min(scale, 2.0));
+    m_ticksUntilNextSample = static_cast<unsigned>(m_ticksUntilNextSample * scale);
+    m_ticksUntilNextSample = max(minimumTicksBetweenSamples, min(m_ticksUntilNextSample, maximumTicksBetweenSamples));
+
+    return min(elapsed, maximumSampleIntervals * m_sampleInterval);
+}
+
 } // namespace JSC
@@ -42,7 +42,7 @@ namespace JSC {
         void setTimeoutInterval(unsigned timeoutInterval) { m_timeoutInterval = timeoutInterval; }
         unsigned timeoutInterval() const { return m_timeoutInterval; }
         
-        unsigned ticksUntilNextCheck() { return m_ticksUntilNextCheck; }
+        unsigned ticksUntilNextCheck() { return m_sampleInterval ? m_ticksUntilNextSample : m_ticksUntilNextCheck; }
         
         void start()
         {
@@ -61,12 +61,29 @@ namespace JSC {
 
         bool didTimeOut(ExecState*);
 
+        // While sampling, checks are made about every sampleInterval seconds so that the
+        // profiler can record the stack, but the timeout is still only evaluated at the
+        // usual rate.
+        void startSampling(double sampleInterval);
+        void stopSampling();
+        bool isSampling() const { return m_sampleInterval; }
+        bool isSampleDue() const;
+
+        // Returns the time in seconds since the previous sample, which is what the new
+        // sample stands for.
+        double takeSample();
+
     private:
         unsigned m_timeoutInterval;
         unsigned m_timeAtLastCheck;
         unsigned m_timeExecuting;
         unsigned m_startCount;
         unsigned m_ticksUntilNextCheck;
+
+        double m_sampleInterval;
+        double m_timeAtLastSample;
+        unsigned m_ticksUntilNextSample;
+        unsigned m_ticksSinceLastCheck;
     };
 
 } // namespace JSC
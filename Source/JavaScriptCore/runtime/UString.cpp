@@ -205,15 +205,13 @@ UString UString::number(double d)
 
 UString UString::substringSharingImpl(unsigned offset, unsigned length) const
 {
-    // FIXME: We used to check against a limit of Heap::minExtraCost / sizeof(UChar).
-
     unsigned stringLength = this->length();
     offset = min(offset, stringLength);
     length = min(length, stringLength - offset);
 
     if (!offset && length == stringLength)
         return *this;
-    return UString(StringImpl::create(m_impl, offset, length));
+    return UString(StringImpl::createSubstringSharingImpl(m_impl, offset, length));
 }
 
 bool operator==(const UString& s1, const char *s2)
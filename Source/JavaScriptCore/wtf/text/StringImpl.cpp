@@ -38,6 +38,8 @@ namespace WTF {
 using namespace Unicode;
 
 static const unsigned minLengthToShare = 20;
+// A shared substring may keep alive a buffer at most this many times its own length.
+static const unsigned maxSubstringRetainedRatio = 8;
 
 COMPILE_ASSERT(sizeof(StringImpl) == 2 * sizeof(int) + 3 * sizeof(void*), StringImpl_should_stay_small);
 
@@ -132,6 +134,17 @@ PassRefPtr<StringImpl> StringImpl::create(const UChar* characters, unsigned leng
     return adoptRef(new StringImpl(characters, length, sharedBuffer));
 }
 
+PassRefPtr<StringImpl> StringImpl::createSubstringSharingImpl(PassRefPtr<StringImpl> rep, unsigned offset, unsigned length)
+{
+    ASSERT(rep);
+    ASSERT(offset + length <= rep->length());
+
+    StringImpl* ownerRep = (rep->bufferOwnership() == BufferSubstring) ? rep->m_substringBuffer : rep.get();
+    if (length < minLengthToShare || ownerRep->length() / maxSubstringRetainedRatio > length)
+        return create(rep->m_data + offset, length);
+    return create(rep, offset, length);
+}
+
 SharedUChar* StringImpl::sharedBuffer()
 {
     if (m_length < minLengthToShare)
@@ -158,6 +158,9 @@ public:
         StringImpl* ownerRep = (rep->bufferOwnership() == BufferSubstring) ? rep->m_substringBuffer : rep.get();
         return adoptRef(new StringImpl(rep->m_data + offset, length, ownerRep));
     }
+    // Like the above, but copies the characters if sharing would keep a buffer
+    // alive that is much larger than the substring, or if the substring is short.
+    static PassRefPtr<StringImpl> createSubstringSharingImpl(PassRefPtr<StringImpl>, unsigned offset, unsigned length);
 
     static PassRefPtr<StringImpl> createUninitialized(unsigned length, UChar*& data);
     static ALWAYS_INLINE PassRefPtr<StringImpl> tryCreateUninitialized(unsigned length, UChar*& output)
@@ -44,6 +44,12 @@ namespace JSC { namespace Yarr {
 
 static const unsigned quantifyInfinite = UINT_MAX;
 
+// Capture-free parentheses with a fixed count up to this limit are expanded into copies.
+static const unsigned maximumUnrolledParenthesesCount = 8;
+// Unrolling nested parentheses multiplies their size, so the copies made for one pattern
+// may add at most this many terms in total.
+static const unsigned maximumUnrolledTermCount = 256;
+
 // The below limit restricts the number of "recursive" match calls in order to
 // avoid spending exponential time on complex regular expressions.
 static const unsigned matchLimit = 1000000;
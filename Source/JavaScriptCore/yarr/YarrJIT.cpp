@@ -451,20 +451,10 @@ class YarrGenerator : private MacroAssembler {
             m_jumpsToNextInteration.append(jumps);
         }
 
-        void addDataLabelToNextIteration(DataLabelPtr dataLabel)
-        {
-            m_dataPtrsToNextIteration.append(dataLabel);
-        }
-
         void linkToNextIteration(Label label)
         {
             m_nextIteration = label;
 
-            for (unsigned i = 0; i < m_dataPtrsToNextIteration.size(); ++i)
-                m_backtrackRecords.append(AlternativeBacktrackRecord(m_dataPtrsToNextIteration[i], m_nextIteration));
-
-            m_dataPtrsToNextIteration.clear();
-
             for (unsigned i = 0; i < m_parenTailsForIteration.size(); ++i)
                 m_parenTailsForIteration[i]->setNextIteration(m_nextIteration);
 
@@ -482,7 +472,6 @@ class YarrGenerator : private MacroAssembler {
         Label m_nextIteration;
         Vector<OwnPtr<ParenthesesTail> > m_parenTails;
         JumpList m_jumpsToNextInteration;
-        Vector<DataLabelPtr> m_dataPtrsToNextIteration;
         Vector<ParenthesesTail*> m_parenTailsForIteration;
     };
 
@@ -1004,15 +993,30 @@ class YarrGenerator : private MacroAssembler {
 
         void propagateBacktrackingFrom(YarrGenerator* generator, BacktrackDestination& backtrack, bool doJump = true)
         {
-            if (doJump)
+            if (doJump) {
                 m_backtrack.jumpToBacktrack(generator, backtrack.getBacktrackJumps());
 
+                // Backtracking into parentheses whose last alternative matched leaves them through the
+                // data label, which must go to the same place as the jumps above.
+                if (backtrack.hasDataLabel() && (m_backtrack.isLabel() || m_backtrack.isStackOffset())) {
+                    linkDataLabelToBacktrackIfExists(generator, backtrack.getDataLabel());
+                    backtrack.clearDataLabel();
+                }
+            }
+
             if (m_backtrack.isLabel() && backtrack.hasBacktrackToLabel())
                 backtrack.linkBacktrackToLabel(m_backtrack.getLabel());
 
             if (backtrack.hasDestination()) {
-                if (m_backtrack.hasDataLabel())
-                    generator->m_expressionState.addDataLabelToNextIteration(m_backtrack.getDataLabel());
+                // The data label is about to be replaced; route it through a jump that joins the pending
+                // backtracks, since going straight to the next iteration leaves index wrong in all but the
+                // last alternative. Without the jump the data label is kept, and linked with the alternative.
+                if (m_backtrack.hasDataLabel() && doJump) {
+                    Jump skipTrampoline = generator->jump();
+                    generator->m_expressionState.m_backtrackRecords.append(AlternativeBacktrackRecord(m_backtrack.getDataLabel(), generator->label()));
+                    m_backtrack.addBacktrackJump(generator->jump());
+                    skipTrampoline.link(generator);
+                }
 
                 m_backtrack.copyTarget(backtrack, doJump);
             }
@@ -1543,6 +1547,61 @@ class YarrGenerator : private MacroAssembler {
         state.setBacktrackLabel(backtrackBegin);
     }
 
+    void generateBackReference(TermGenerationState& state)
+    {
+        const RegisterID matchIndex = regT0;
+        const RegisterID character = regT1;
+        PatternTerm& term = state.term();
+        ASSERT(!m_pattern.m_ignoreCase);
+        ASSERT((term.quantityType == QuantifierFixedCount) && (term.quantityCount == 1));
+
+        Address subpatternStart(output, (term.backReferenceSubpatternId << 1) * sizeof(int));
+        Address subpatternEnd(output, ((term.backReferenceSubpatternId << 1) + 1) * sizeof(int));
+
+        // A reference to a subpattern that did not participate in the match matches the empty string.
+        load32(subpatternStart, matchIndex);
+        Jump unmatchedSubpattern = branch32(Equal, matchIndex, TrustedImm32(-1));
+
+        // Record the length we are about to consume, so that backtracking can undo it.
+        load32(subpatternEnd, character);
+        sub32(matchIndex, character);
+        storeToFrame(character, term.frameLocation);
+
+        add32(index, character);
+        if (state.inputOffset())
+            add32(Imm32(state.inputOffset()), character);
+        state.jumpToBacktrack(this, branch32(GreaterThan, character, length));
+
+        Label loop(this);
+        Jump matched = branch32(Equal, matchIndex, subpatternEnd);
+        load16(BaseIndex(input, matchIndex, TimesTwo), character);
+        Jump mismatch = branch16(NotEqual, BaseIndex(input, index, TimesTwo, state.inputOffset() * sizeof(UChar)), character);
+        add32(TrustedImm32(1), matchIndex);
+        add32(TrustedImm32(1), index);
+        jump(loop);
+
+        // Rewind over the characters that did compare equal.
+        mismatch.link(this);
+        load32(subpatternStart, character);
+        sub32(character, matchIndex);
+        sub32(matchIndex, index);
+        state.jumpToBacktrack(this);
+
+        unmatchedSubpattern.link(this);
+        storeToFrame(TrustedImm32(0), term.frameLocation);
+        Jump matchedEmpty = jump();
+
+        Label backtrackBegin(this);
+        loadFromFrame(term.frameLocation, character);
+        sub32(character, index);
+        state.jumpToBacktrack(this);
+
+        matched.link(this);
+        matchedEmpty.link(this);
+
+        state.setBacktrackLabel(backtrackBegin);
+    }
+
     void generateParenthesesDisjunction(PatternTerm& parenthesesTerm, TermGenerationState& state, unsigned alternativeFrameLocation)
     {
         ASSERT((parenthesesTerm.type == PatternTerm::TypeParenthesesSubpattern) || (parenthesesTerm.type == PatternTerm::TypeParentheticalAssertion));
@@ -1897,10 +1956,15 @@ class YarrGenerator : private MacroAssembler {
             break;
 
         case PatternTerm::TypeBackReference:
-            m_shouldFallBack = true;
+            if (m_canCompileBackReferences)
+                generateBackReference(state);
+            else
+                m_shouldFallBack = true;
             break;
 
         case PatternTerm::TypeForwardReference:
+            if (!m_canCompileBackReferences)
+                m_shouldFallBack = true;
             break;
 
         case PatternTerm::TypeParenthesesSubpattern:
@@ -2227,11 +2291,85 @@ public:
     YarrGenerator(YarrPattern& pattern)
         : m_pattern(pattern)
         , m_shouldFallBack(false)
+        , m_canCompileBackReferences(false)
+    {
+    }
+
+    // A back-reference is matched against the subpattern offsets already written to the output
+    // vector.  That is only correct if the referenced subpattern is captured at most once per
+    // match attempt and the back-reference itself is not repeated; the rest is left to the
+    // interpreter.  A back-reference inside the group it refers to, including one in an
+    // alternative of that group, is parsed as a forward reference; the backtracking labels
+    // do not yet handle the alternatives around it, so those patterns are interpreted too.
+    bool checkBackReferences(PatternDisjunction* disjunction, bool matchedOnce, Vector<unsigned>& captureCounts, Vector<bool>& capturedOnce, Vector<unsigned>& backReferences)
+    {
+        for (unsigned alt = 0; alt < disjunction->m_alternatives.size(); ++alt) {
+            Vector<PatternTerm>& terms = disjunction->m_alternatives[alt]->m_terms;
+            for (unsigned i = 0; i < terms.size(); ++i) {
+                PatternTerm& term = terms[i];
+                switch (term.type) {
+                case PatternTerm::TypeBackReference:
+                    if (!matchedOnce || (term.quantityType != QuantifierFixedCount) || (term.quantityCount != 1))
+                        return false;
+                    backReferences.append(term.backReferenceSubpatternId);
+                    break;
+
+                case PatternTerm::TypeForwardReference:
+                    return false;
+
+                case PatternTerm::TypeParenthesesSubpattern: {
+                    bool parenthesesMatchedOnce = matchedOnce && (term.quantityCount == 1) && !term.parentheses.isCopy;
+                    if (term.capture()) {
+                        captureCounts[term.parentheses.subpatternId]++;
+                        capturedOnce[term.parentheses.subpatternId] = parenthesesMatchedOnce;
+                    }
+                    if (!checkBackReferences(term.parentheses.disjunction, parenthesesMatchedOnce, captureCounts, capturedOnce, backReferences))
+                        return false;
+                    break;
+                }
+
+                case PatternTerm::TypeParentheticalAssertion:
+                    if (!checkBackReferences(term.parentheses.disjunction, false, captureCounts, capturedOnce, backReferences))
+                        return false;
+                    break;
+
+                default:
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool canCompileBackReferences()
     {
+        if (m_pattern.m_ignoreCase)
+            return false;
+
+        Vector<unsigned> captureCounts;
+        captureCounts.fill(0, m_pattern.m_numSubpatterns + 1);
+        Vector<bool> capturedOnce;
+        capturedOnce.fill(false, m_pattern.m_numSubpatterns + 1);
+        Vector<unsigned> backReferences;
+
+        if (!checkBackReferences(m_pattern.m_body, true, captureCounts, capturedOnce, backReferences))
+            return false;
+
+        for (unsigned i = 0; i < backReferences.size(); ++i) {
+            unsigned subpatternId = backReferences[i];
+            if ((captureCounts[subpatternId] != 1) || !capturedOnce[subpatternId])
+                return false;
+        }
+
+        return true;
     }
 
     void generate()
     {
+        if (m_pattern.m_containsBackreferences)
+            m_canCompileBackReferences = canCompileBackReferences();
+
         generateEnter();
 
         if (!m_pattern.m_body->m_hasFixedSize)
@@ -2247,7 +2385,14 @@ public:
     {
         generate();
 
-        LinkBuffer patchBuffer(this, globalData->regexAllocator.poolForSize(size()), 0);
+        // If executable memory is exhausted, run this pattern in the interpreter.
+        RefPtr<ExecutablePool> executablePool = globalData->regexAllocator.tryPoolForSize(size());
+        if (!executablePool) {
+            jitObject.setFallBack(true);
+            return;
+        }
+
+        LinkBuffer patchBuffer(this, executablePool.release(), 0);
 
         for (unsigned i = 0; i < m_expressionState.m_backtrackRecords.size(); ++i)
             patchBuffer.patch(m_expressionState.m_backtrackRecords[i].dataLabel, patchBuffer.locationOf(m_expressionState.m_backtrackRecords[i].backtrackLocation));
@@ -2259,6 +2404,7 @@ public:
 private:
     YarrPattern& m_pattern;
     bool m_shouldFallBack;
+    bool m_canCompileBackReferences;
     GenerationState m_expressionState;
 };
 
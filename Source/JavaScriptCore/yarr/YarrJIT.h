@@ -62,6 +62,7 @@ public:
     void setFallBack(bool fallback) { m_needFallBack = fallback; }
     bool isFallBack() { return m_needFallBack; }
     void set(MacroAssembler::CodeRef ref) { m_ref = ref; }
+    size_t size() const { return m_ref.m_size; }
 
     int execute(const UChar* input, unsigned start, unsigned length, int* output)
     {
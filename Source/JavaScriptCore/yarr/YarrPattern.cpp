@@ -759,6 +759,78 @@ public:
         setupDisjunctionOffsets(m_pattern.m_body, 0, 0);
     }
 
+    // Parentheses that neither capture nor contain capturing subpatterns can be repeated
+    // without any bookkeeping for the subpattern offsets of prior iterations.
+    bool containsNoCaptures(PatternTerm& term)
+    {
+        if (term.capture())
+            return false;
+
+        PatternDisjunction* disjunction = term.parentheses.disjunction;
+        for (unsigned alt = 0; alt < disjunction->m_alternatives.size(); ++alt) {
+            Vector<PatternTerm>& terms = disjunction->m_alternatives[alt]->m_terms;
+            for (unsigned i = 0; i < terms.size(); ++i) {
+                if (((terms[i].type == PatternTerm::TypeParenthesesSubpattern) || (terms[i].type == PatternTerm::TypeParentheticalAssertion))
+                    && !containsNoCaptures(terms[i]))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    // Only parentheses with a count of one can be matched by the JIT, so expand small fixed
+    // counts on capture-free parentheses into a sequence of copies, e.g. (?:ab){3} becomes
+    // (?:ab)(?:ab)(?:ab).  The remainder of a bounded quantifier such as (?:ab){1,2} is a copy
+    // with a count of one; without captures it behaves exactly like (?:ab)?, so unmark it.
+    // Returns the number of terms in the disjunction, counting those nested in parentheses.
+    unsigned unrollParentheses(PatternDisjunction* disjunction, unsigned& termBudget)
+    {
+        unsigned termCount = 0;
+        for (unsigned alt = 0; alt < disjunction->m_alternatives.size(); ++alt) {
+            Vector<PatternTerm>& terms = disjunction->m_alternatives[alt]->m_terms;
+            for (unsigned i = 0; i < terms.size(); ++i) {
+                ++termCount;
+                if ((terms[i].type != PatternTerm::TypeParenthesesSubpattern) && (terms[i].type != PatternTerm::TypeParentheticalAssertion))
+                    continue;
+
+                unsigned termSize = 1 + unrollParentheses(terms[i].parentheses.disjunction, termBudget);
+                termCount += termSize - 1;
+
+                if ((terms[i].type != PatternTerm::TypeParenthesesSubpattern) || !containsNoCaptures(terms[i]))
+                    continue;
+
+                if (terms[i].quantityCount == 1) {
+                    terms[i].parentheses.isCopy = false;
+                    continue;
+                }
+
+                if ((terms[i].quantityType != QuantifierFixedCount) || (terms[i].quantityCount > maximumUnrolledParenthesesCount))
+                    continue;
+
+                unsigned count = terms[i].quantityCount;
+                unsigned addedTerms = (count - 1) * termSize;
+                if (addedTerms > termBudget)
+                    continue;
+                termBudget -= addedTerms;
+                termCount += addedTerms;
+
+                terms[i].quantify(1, QuantifierFixedCount);
+                for (unsigned copy = 1; copy < count; ++copy) {
+                    PatternTerm termCopy = copyTerm(terms[i]);
+                    terms.insert(i + copy, termCopy);
+                }
+                i += count - 1;
+            }
+        }
+        return termCount;
+    }
+
+    void unrollParentheses()
+    {
+        unsigned termBudget = maximumUnrolledTermCount;
+        unrollParentheses(m_pattern.m_body, termBudget);
+    }
+
     // This optimization identifies sets of parentheses that we will never need to backtrack.
     // In these cases we do not need to store state from prior iterations.
     // We can presently avoid backtracking for:
@@ -768,11 +840,6 @@ public:
     //   * where the parens do not contain any capturing subpatterns.
     void checkForTerminalParentheses()
     {
-        // This check is much too crude; should be just checking whether the candidate
-        // node contains nested capturing subpatterns, not the whole expression!
-        if (m_pattern.m_numSubpatterns)
-            return;
-
         Vector<PatternAlternative*>& alternatives = m_pattern.m_body->m_alternatives;
         for (size_t i = 0; i < alternatives.size(); ++i) {
             Vector<PatternTerm>& terms = alternatives[i]->m_terms;
@@ -781,7 +848,7 @@ public:
                 if (term.type == PatternTerm::TypeParenthesesSubpattern
                     && term.quantityType == QuantifierGreedy
                     && term.quantityCount == quantifyInfinite
-                    && !term.capture())
+                    && containsNoCaptures(term))
                     term.parentheses.isTerminal = true;
             }
         }
@@ -956,7 +1023,7 @@ private:
     bool m_invertParentheticalAssertion;
 };
 
-const char* YarrPattern::compile(const UString& patternString)
+const char* YarrPattern::compile(const UString& patternString, bool unrollParenthesesForJIT)
 {
     YarrPatternConstructor constructor(*this);
 
@@ -980,6 +1047,8 @@ const char* YarrPattern::compile(const UString& patternString)
         ASSERT(numSubpatterns == m_numSubpatterns);
     }
 
+    if (unrollParenthesesForJIT)
+        constructor.unrollParentheses();
     constructor.checkForTerminalParentheses();
     constructor.optimizeBOL();
         
@@ -989,7 +1058,7 @@ const char* YarrPattern::compile(const UString& patternString)
     return 0;
 }
 
-YarrPattern::YarrPattern(const UString& pattern, bool ignoreCase, bool multiline, const char** error)
+YarrPattern::YarrPattern(const UString& pattern, bool ignoreCase, bool multiline, const char** error, bool unrollParenthesesForJIT)
     : m_ignoreCase(ignoreCase)
     , m_multiline(multiline)
     , m_containsBackreferences(false)
@@ -1005,7 +1074,7 @@ YarrPattern::YarrPattern(const UString& pattern, bool ignoreCase, bool multiline
     , nonspacesCached(0)
     , nonwordcharCached(0)
 {
-    *error = compile(pattern);
+    *error = compile(pattern, unrollParenthesesForJIT);
 }
 
 } }
@@ -313,7 +313,9 @@ struct BeginChar {
 };
 
 struct YarrPattern {
-    YarrPattern(const UString& pattern, bool ignoreCase, bool multiline, const char** error);
+    // Patterns built for the JIT have small fixed counts on capture-free parentheses unrolled
+    // into copies.  The interpreter must be given a pattern that was built without unrolling.
+    YarrPattern(const UString& pattern, bool ignoreCase, bool multiline, const char** error, bool unrollParenthesesForJIT = false);
 
     ~YarrPattern()
     {
@@ -406,7 +408,7 @@ struct YarrPattern {
     Vector<BeginChar> m_beginChars;
 
 private:
-    const char* compile(const UString& patternString);
+    const char* compile(const UString& patternString, bool unrollParenthesesForJIT);
 
     CharacterClass* newlineCached;
     CharacterClass* digitsCached;
@@ -58,6 +58,7 @@ namespace WebCore {
 
 CSSFontSelector::CSSFontSelector(Document* document)
     : m_document(document)
+    , m_version(0)
 {
     // FIXME: An old comment used to say there was no need to hold a reference to m_document
     // because "we are guaranteed to be destroyed before the document". But there does not
@@ -65,6 +66,7 @@ CSSFontSelector::CSSFontSelector(Document* document)
 
     ASSERT(m_document);
     fontCache()->addClient(this);
+    updateVersion();
 }
 
 CSSFontSelector::~CSSFontSelector()
@@ -344,6 +346,8 @@ void CSSFontSelector::addFontFaceRule(const CSSFontFaceRule* fontFaceRule)
 
         familyFontFaces->append(fontFace);
     }
+
+    updateVersion();
 }
 
 void CSSFontSelector::registerForInvalidationCallbacks(FontSelectorClient* client)
@@ -356,8 +360,16 @@ void CSSFontSelector::unregisterForInvalidationCallbacks(FontSelectorClient* cli
     m_clients.remove(client);
 }
 
+void CSSFontSelector::updateVersion()
+{
+    static unsigned fontSelectorVersion = 0;
+    m_version = ++fontSelectorVersion;
+}
+
 void CSSFontSelector::dispatchInvalidationCallbacks()
 {
+    updateVersion();
+
     Vector<FontSelectorClient*> clients;
     copyToVector(m_clients, clients);
     for (size_t i = 0; i < clients.size(); ++i)
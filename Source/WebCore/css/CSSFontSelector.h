@@ -63,6 +63,8 @@ public:
 
     bool isEmpty() const;
 
+    virtual unsigned version() const { return m_version; }
+
     CachedResourceLoader* cachedResourceLoader() const;
 
     virtual void registerForInvalidationCallbacks(FontSelectorClient*);
@@ -72,12 +74,14 @@ private:
     CSSFontSelector(Document*);
 
     void dispatchInvalidationCallbacks();
+    void updateVersion();
 
     Document* m_document;
     HashMap<String, Vector<RefPtr<CSSFontFace> >*, CaseFoldingHash> m_fontFaces;
     HashMap<String, Vector<RefPtr<CSSFontFace> >*, CaseFoldingHash> m_locallyInstalledFontFaces;
     HashMap<String, HashMap<unsigned, RefPtr<CSSSegmentedFontFace> >*, CaseFoldingHash> m_fonts;
     HashSet<FontSelectorClient*> m_clients;
+    unsigned m_version;
 };
 
 } // namespace WebCore
@@ -198,6 +198,8 @@ static int cssyylex(YYSTYPE* yylval, void* parser)
 
 %token <string> UNICODERANGE
 
+%token <string> UNPARSED_DECLARATION_BLOCK
+
 %type <relation> combinator
 
 %type <rule> charset
@@ -810,6 +812,7 @@ before_rule_opening_brace:
     /* empty */ {
         CSSParser* p = static_cast<CSSParser*>(parser);
         p->markSelectorListEnd();
+        p->deferDeclarationBlockParsing();
     }
   ;
 
@@ -818,6 +821,10 @@ ruleset:
         CSSParser* p = static_cast<CSSParser*>(parser);
         $$ = p->createStyleRule($1);
     }
+  | selector_list before_rule_opening_brace '{' UNPARSED_DECLARATION_BLOCK {
+        CSSParser* p = static_cast<CSSParser*>(parser);
+        $$ = p->createStyleRuleWithUnparsedDeclaration($1, $4);
+    }
   ;
 
 selector_list:
@@ -153,6 +153,9 @@ CSSParser::CSSParser(bool strictParsing)
     , m_propertyRange(UINT_MAX, UINT_MAX)
     , m_ruleRangeMap(0)
     , m_currentRuleData(0)
+    , m_deferDeclarationParsing(false)
+    , m_lexUnparsedDeclarationBlock(false)
+    , m_reachedEndInUnparsedDeclarationBlock(false)
     , m_data(0)
     , yy_start(1)
     , m_lineNumber(0)
@@ -234,9 +237,16 @@ void CSSParser::parseSheet(CSSStyleSheet* sheet, const String& string, int start
         m_currentRuleData->styleSourceData = CSSStyleSourceData::create();
     }
 
+    // The inspector needs source ranges for every property, so only defer declaration parsing without it.
+    m_deferDeclarationParsing = !ruleRangeMap;
+    m_reachedEndInUnparsedDeclarationBlock = false;
+    m_sheetText = string;
+
     m_lineNumber = startLineNumber;
     setupParser("", string, "");
     cssyyparse(this);
+    m_deferDeclarationParsing = false;
+    m_sheetText = String();
     m_ruleRangeMap = 0;
     m_currentRuleData = 0;
     m_rule = 0;
@@ -5922,6 +5932,17 @@ int CSSParser::lex(void* yylvalWithoutType)
     YYSTYPE* yylval = static_cast<YYSTYPE*>(yylvalWithoutType);
     int length;
 
+    if (m_lexUnparsedDeclarationBlock) {
+        m_lexUnparsedDeclarationBlock = false;
+        skipDeclarationBlock(yylval->string);
+        yyTok = UNPARSED_DECLARATION_BLOCK;
+        return yyTok;
+    }
+    if (m_reachedEndInUnparsedDeclarationBlock) {
+        yyTok = END_TOKEN;
+        return yyTok;
+    }
+
     lex();
 
     UChar* t = text(&length);
@@ -5998,6 +6019,39 @@ int CSSParser::lex(void* yylvalWithoutType)
     return token();
 }
 
+void CSSParser::deferDeclarationBlockParsing()
+{
+    // The grammar calls this once it has seen the '{' opening a style rule's declaration block as its lookahead,
+    // so the next token requested is the start of the block.
+    if (m_deferDeclarationParsing && token() == '{')
+        m_lexUnparsedDeclarationBlock = true;
+}
+
+void CSSParser::skipDeclarationBlock(CSSParserString& declaration)
+{
+    // Run the tokenizer over the block without handing the tokens to the grammar, so that braces inside
+    // strings, comments and url() do not end the block early.
+    UChar* blockStart = yytext + yyleng;
+    UChar* blockEnd = blockStart;
+    unsigned nestingLevel = 1;
+    while (true) {
+        lex();
+        if (token() == END_TOKEN) {
+            m_reachedEndInUnparsedDeclarationBlock = true;
+            break;
+        }
+        if (token() == '{')
+            ++nestingLevel;
+        else if (token() == '}' && !--nestingLevel) {
+            blockEnd = yytext;
+            break;
+        }
+        blockEnd = yytext + yyleng;
+    }
+    declaration.characters = blockStart;
+    declaration.length = blockEnd - blockStart;
+}
+
 void CSSParser::recheckAtKeyword(const UChar* str, int len)
 {
     String ruleName(str, len);
@@ -6343,6 +6397,28 @@ CSSRule* CSSParser::createStyleRule(Vector<OwnPtr<CSSParserSelector> >* selector
     return result;
 }
 
+CSSRule* CSSParser::createStyleRuleWithUnparsedDeclaration(Vector<OwnPtr<CSSParserSelector> >* selectors, const CSSParserString& declaration)
+{
+    ASSERT(!m_ruleRangeMap);
+    ASSERT(!m_numParsedProperties);
+    CSSStyleRule* result = 0;
+    if (selectors) {
+        m_allowImportRules = m_allowNamespaceDeclarations = false;
+        RefPtr<CSSStyleRule> rule = CSSStyleRule::create(m_styleSheet, m_lastSelectorLineNumber);
+        rule->adoptSelectorVector(*selectors);
+        // parseSheet() adds no prefix, so offsets into m_data are offsets into the sheet text. Referring to the
+        // sheet text rather than copying lets every document parsing the same cached sheet share one buffer.
+        unsigned offset = declaration.characters - m_data;
+        ASSERT(offset + declaration.length <= m_sheetText.length());
+        rule->setUnparsedDeclaration(StringImpl::create(m_sheetText.impl(), offset, declaration.length));
+        result = rule.get();
+        m_parsedStyleObjects.append(rule.release());
+    }
+    resetSelectorListMarks();
+    resetRuleBodyMarks();
+    return result;
+}
+
 CSSRule* CSSParser::createFontFaceRule()
 {
     m_allowImportRules = m_allowNamespaceDeclarations = false;
@@ -204,6 +204,7 @@ namespace WebCore {
         CSSRule* createMediaRule(MediaList*, CSSRuleList*);
         CSSRuleList* createRuleList();
         CSSRule* createStyleRule(Vector<OwnPtr<CSSParserSelector> >* selectors);
+        CSSRule* createStyleRuleWithUnparsedDeclaration(Vector<OwnPtr<CSSParserSelector> >* selectors, const CSSParserString& declaration);
         CSSRule* createFontFaceRule();
         CSSRule* createPageRule(PassOwnPtr<CSSParserSelector> pageSelector);
         CSSRule* createMarginAtRule(CSSSelector::MarginBoxType marginBox);
@@ -269,6 +270,13 @@ namespace WebCore {
         void resetSelectorListMarks() { m_selectorListRange.start = m_selectorListRange.end = 0; }
         void resetRuleBodyMarks() { m_ruleBodyRange.start = m_ruleBodyRange.end = 0; }
         void resetPropertyMarks() { m_propertyRange.start = m_propertyRange.end = UINT_MAX; }
+
+        // Style rule declaration blocks in a sheet are kept as text and parsed when the rule is first used.
+        bool m_deferDeclarationParsing;
+        String m_sheetText;
+        bool m_lexUnparsedDeclarationBlock;
+        bool m_reachedEndInUnparsedDeclarationBlock;
+        void deferDeclarationBlockParsing();
         int lex(void* yylval);
         int token() { return yyTok; }
         UChar* text(int* length);
@@ -279,6 +287,7 @@ namespace WebCore {
         void setStyleSheet(CSSStyleSheet*);
         
         void recheckAtKeyword(const UChar* str, int len);
+        void skipDeclarationBlock(CSSParserString&);
 
         void setupParser(const char* prefix, const String&, const char* suffix);
 
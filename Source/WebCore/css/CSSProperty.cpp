@@ -282,4 +282,112 @@ int CSSProperty::resolveDirectionAwareProperty(int propertyID, TextDirection dir
     }
 }
 
+bool CSSProperty::isInheritedProperty(int propertyID)
+{
+    // This follows where RenderStyle stores the value rather than the specification,
+    // so a few properties like resize that live in the inherited data are listed too.
+    switch (propertyID) {
+    case CSSPropertyColor:
+    case CSSPropertyDirection:
+    case CSSPropertyFont:
+    case CSSPropertyFontFamily:
+    case CSSPropertyFontSize:
+    case CSSPropertyFontStyle:
+    case CSSPropertyFontVariant:
+    case CSSPropertyFontWeight:
+    case CSSPropertyTextRendering:
+    case CSSPropertyWebkitFontSmoothing:
+    case CSSPropertyWebkitTextOrientation:
+    case CSSPropertyWebkitTextSizeAdjust:
+    case CSSPropertyWebkitWritingMode:
+    case CSSPropertyZoom:
+    case CSSPropertyLineHeight:
+    case CSSPropertyBorderCollapse:
+    case CSSPropertyBorderSpacing:
+    case CSSPropertyCaptionSide:
+    case CSSPropertyCursor:
+    case CSSPropertyEmptyCells:
+    case CSSPropertyFontStretch:
+    case CSSPropertyLetterSpacing:
+    case CSSPropertyListStyle:
+    case CSSPropertyListStyleImage:
+    case CSSPropertyListStylePosition:
+    case CSSPropertyListStyleType:
+    case CSSPropertyOrphans:
+    case CSSPropertyPointerEvents:
+    case CSSPropertyQuotes:
+    case CSSPropertyResize:
+    case CSSPropertySpeak:
+    case CSSPropertyTextAlign:
+    case CSSPropertyTextIndent:
+    case CSSPropertyTextShadow:
+    case CSSPropertyTextTransform:
+    case CSSPropertyVisibility:
+    case CSSPropertyWhiteSpace:
+    case CSSPropertyWidows:
+    case CSSPropertyWordBreak:
+    case CSSPropertyWordSpacing:
+    case CSSPropertyWordWrap:
+    case CSSPropertyWebkitBorderHorizontalSpacing:
+    case CSSPropertyWebkitBorderVerticalSpacing:
+    case CSSPropertyWebkitBoxDirection:
+    case CSSPropertyWebkitColorCorrection:
+    case CSSPropertyWebkitFontSizeDelta:
+    case CSSPropertyWebkitHighlight:
+    case CSSPropertyWebkitHyphenateCharacter:
+    case CSSPropertyWebkitHyphenateLimitAfter:
+    case CSSPropertyWebkitHyphenateLimitBefore:
+    case CSSPropertyWebkitHyphens:
+    case CSSPropertyWebkitLineBoxContain:
+    case CSSPropertyWebkitLineBreak:
+    case CSSPropertyWebkitLocale:
+    case CSSPropertyWebkitNbspMode:
+    case CSSPropertyWebkitRtlOrdering:
+    case CSSPropertyWebkitTextDecorationsInEffect:
+    case CSSPropertyWebkitTextEmphasis:
+    case CSSPropertyWebkitTextEmphasisColor:
+    case CSSPropertyWebkitTextEmphasisPosition:
+    case CSSPropertyWebkitTextEmphasisStyle:
+    case CSSPropertyWebkitTextFillColor:
+    case CSSPropertyWebkitTextSecurity:
+    case CSSPropertyWebkitTextStroke:
+    case CSSPropertyWebkitTextStrokeColor:
+    case CSSPropertyWebkitTextStrokeWidth:
+    case CSSPropertyWebkitUserModify:
+    case CSSPropertyWebkitUserSelect:
+#if ENABLE(SVG)
+    case CSSPropertyClipRule:
+    case CSSPropertyColorInterpolation:
+    case CSSPropertyColorInterpolationFilters:
+    case CSSPropertyColorProfile:
+    case CSSPropertyColorRendering:
+    case CSSPropertyFill:
+    case CSSPropertyFillOpacity:
+    case CSSPropertyFillRule:
+    case CSSPropertyGlyphOrientationHorizontal:
+    case CSSPropertyGlyphOrientationVertical:
+    case CSSPropertyImageRendering:
+    case CSSPropertyKerning:
+    case CSSPropertyMarker:
+    case CSSPropertyMarkerEnd:
+    case CSSPropertyMarkerMid:
+    case CSSPropertyMarkerStart:
+    case CSSPropertyShapeRendering:
+    case CSSPropertyStroke:
+    case CSSPropertyStrokeDasharray:
+    case CSSPropertyStrokeDashoffset:
+    case CSSPropertyStrokeLinecap:
+    case CSSPropertyStrokeLinejoin:
+    case CSSPropertyStrokeMiterlimit:
+    case CSSPropertyStrokeOpacity:
+    case CSSPropertyStrokeWidth:
+    case CSSPropertyTextAnchor:
+    case CSSPropertyWritingMode:
+#endif
+        return true;
+    default:
+        return false;
+    }
+}
+
 } // namespace WebCore
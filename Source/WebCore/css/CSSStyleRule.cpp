@@ -57,14 +57,14 @@ String CSSStyleRule::selectorText() const
 void CSSStyleRule::setSelectorText(const String& selectorText)
 {
     Document* doc = 0;
-    StyleSheet* ownerStyleSheet = m_style->stylesheet();
+    // Going through style() would parse a declaration block that has not been parsed yet.
+    CSSStyleSheet* ownerStyleSheet = parentStyleSheet();
     if (ownerStyleSheet) {
-        if (ownerStyleSheet->isCSSStyleSheet())
-            doc = static_cast<CSSStyleSheet*>(ownerStyleSheet)->document();
+        doc = ownerStyleSheet->document();
         if (!doc)
             doc = ownerStyleSheet->ownerNode() ? ownerStyleSheet->ownerNode()->document() : 0;
     }
-    if (!doc)
+    if (!doc && m_style)
         doc = m_style->node() ? m_style->node()->document() : 0;
 
     if (!doc)
@@ -89,7 +89,7 @@ String CSSStyleRule::cssText() const
     String result = selectorText();
 
     result += " { ";
-    result += m_style->cssText();
+    result += style()->cssText();
     result += "}";
 
     return result;
@@ -104,12 +104,32 @@ bool CSSStyleRule::parseString(const String& /*string*/, bool /*strict*/)
 void CSSStyleRule::setDeclaration(PassRefPtr<CSSMutableStyleDeclaration> style)
 {
     m_style = style;
+    m_unparsedDeclaration = String();
 }
 
-void CSSStyleRule::addSubresourceStyleURLs(ListHashSet<KURL>& urls)
+void CSSStyleRule::setUnparsedDeclaration(const String& declaration)
 {
+    ASSERT(!declaration.isNull());
     if (m_style)
-        m_style->addSubresourceStyleURLs(urls);
+        m_style->setParent(0);
+    m_style = 0;
+    m_unparsedDeclaration = declaration;
+}
+
+void CSSStyleRule::parseUnparsedDeclaration() const
+{
+    ASSERT(!m_style);
+    CSSStyleRule* rule = const_cast<CSSStyleRule*>(this);
+    m_style = CSSMutableStyleDeclaration::create(rule);
+    CSSParser parser(useStrictParsing());
+    parser.parseDeclaration(m_style.get(), m_unparsedDeclaration);
+    m_unparsedDeclaration = String();
+}
+
+void CSSStyleRule::addSubresourceStyleURLs(ListHashSet<KURL>& urls)
+{
+    if (CSSMutableStyleDeclaration* style = this->style())
+        style->addSubresourceStyleURLs(urls);
 }
 
 } // namespace WebCore
@@ -26,6 +26,7 @@
 #include "CSSSelectorList.h"
 #include <wtf/PassRefPtr.h>
 #include <wtf/RefPtr.h>
+#include <wtf/text/WTFString.h>
 
 namespace WebCore {
 
@@ -43,7 +44,12 @@ public:
     virtual String selectorText() const;
     void setSelectorText(const String&);
 
-    CSSMutableStyleDeclaration* style() const { return m_style.get(); }
+    CSSMutableStyleDeclaration* style() const
+    {
+        if (!m_unparsedDeclaration.isNull())
+            parseUnparsedDeclaration();
+        return m_style.get();
+    }
 
     virtual String cssText() const;
 
@@ -52,9 +58,11 @@ public:
 
     void adoptSelectorVector(Vector<OwnPtr<CSSParserSelector> >& selectors) { m_selectorList.adoptSelectorVector(selectors); }
     void setDeclaration(PassRefPtr<CSSMutableStyleDeclaration>);
+    // The declaration block text is parsed the first time the declaration is needed.
+    void setUnparsedDeclaration(const String&);
 
     const CSSSelectorList& selectorList() const { return m_selectorList; }
-    CSSMutableStyleDeclaration* declaration() { return m_style.get(); }
+    CSSMutableStyleDeclaration* declaration() { return style(); }
 
     virtual void addSubresourceStyleURLs(ListHashSet<KURL>& urls);
 
@@ -69,7 +77,10 @@ private:
     // Inherited from CSSRule
     virtual unsigned short type() const { return STYLE_RULE; }
 
-    RefPtr<CSSMutableStyleDeclaration> m_style;
+    void parseUnparsedDeclaration() const;
+
+    mutable RefPtr<CSSMutableStyleDeclaration> m_style;
+    mutable String m_unparsedDeclaration;
     CSSSelectorList m_selectorList;
     int m_sourceLine;
 };
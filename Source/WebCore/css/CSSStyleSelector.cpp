@@ -99,6 +99,7 @@
 #include "WebKitCSSTransformValue.h"
 #include "XMLNames.h"
 #include <wtf/StdLibExtras.h>
+#include <wtf/StringHasher.h>
 #include <wtf/Vector.h>
 
 #if USE(PLATFORM_STRATEGIES)
@@ -297,6 +298,7 @@ public:
     bool hasFastCheckableSelector() const { return m_hasFastCheckableSelector; }
     bool hasMultipartSelector() const { return m_hasMultipartSelector; }
     bool hasTopSelectorMatchingHTMLBasedOnRuleHash() const { return m_hasTopSelectorMatchingHTMLBasedOnRuleHash; }
+    bool hasSubjectFastReject() const { return m_hasSubjectFastReject; }
     unsigned specificity() const { return m_specificity; }
     
     // Try to balance between memory usage (there can be lots of RuleData objects) and good filtering performance.
@@ -310,10 +312,11 @@ private:
     CSSStyleRule* m_rule;
     CSSSelector* m_selector;
     unsigned m_specificity;
-    unsigned m_position : 29;
+    unsigned m_position : 28;
     bool m_hasFastCheckableSelector : 1;
     bool m_hasMultipartSelector : 1;
     bool m_hasTopSelectorMatchingHTMLBasedOnRuleHash : 1;
+    bool m_hasSubjectFastReject : 1;
     // Use plain array instead of a Vector to minimize memory overhead.
     unsigned m_descendantSelectorIdentifierHashes[maximumIdentifierCount];
 };
@@ -337,6 +340,10 @@ public:
     void disableAutoShrinkToFit() { m_autoShrinkToFitEnabled = false; }
 
     void collectFeatures(CSSStyleSelector::Features&) const;
+
+    CSSStyleSelector::InvalidationScope invalidationScopeForClass(AtomicStringImpl* className) const { return invalidationScope(m_classesInRules, className); }
+    CSSStyleSelector::InvalidationScope invalidationScopeForId(AtomicStringImpl* id) const { return invalidationScope(m_idsInRules, id); }
+    CSSStyleSelector::InvalidationScope invalidationScopeForAttribute(AtomicStringImpl* localName) const { return invalidationScope(m_attributesInRules, localName); }
     
     const Vector<RuleData>* getIDRules(AtomicStringImpl* key) const { return m_idRules.get(key); }
     const Vector<RuleData>* getClassRules(AtomicStringImpl* key) const { return m_classRules.get(key); }
@@ -354,6 +361,20 @@ public:
     Vector<RuleData> m_pageRules;
     unsigned m_ruleCount;
     bool m_autoShrinkToFitEnabled;
+
+private:
+    // Maps each class, id or attribute name used by a selector to whether it is ever used
+    // outside the subject, where a change to one element can alter the style of others.
+    typedef HashMap<AtomicStringImpl*, bool> SelectorFeatureMap;
+
+    void collectInvalidationFeatures(const CSSSelector*);
+    void collectInvalidationFeaturesFromSimpleSelector(const CSSSelector*, bool isSubject);
+    static void addInvalidationFeature(SelectorFeatureMap&, AtomicStringImpl*, bool isSubject);
+    static CSSStyleSelector::InvalidationScope invalidationScope(const SelectorFeatureMap&, AtomicStringImpl*);
+
+    SelectorFeatureMap m_classesInRules;
+    SelectorFeatureMap m_idsInRules;
+    SelectorFeatureMap m_attributesInRules;
 };
 
 static RuleSet* defaultStyle;
@@ -1444,52 +1465,15 @@ PassRefPtr<RenderStyle> CSSStyleSelector::styleForElement(Element* e, RenderStyl
 
     // Reset the value back before applying properties, so that -webkit-link knows what color to use.
     m_checker.m_matchVisitedPseudoClass = matchVisitedPseudoClass;
-    
-    // Now we have all of the matched rules in the appropriate order.  Walk the rules and apply
-    // high-priority properties first, i.e., those properties that other properties depend on.
-    // The order is (1) high-priority not important, (2) high-priority important, (3) normal not important
-    // and (4) normal important.
-    m_lineHeightValue = 0;
-    applyDeclarations<true>(false, 0, m_matchedDecls.size() - 1);
-    if (!resolveForRootDefault) {
-        applyDeclarations<true>(true, firstAuthorRule, lastAuthorRule);
-        applyDeclarations<true>(true, firstUserRule, lastUserRule);
-    }
-    applyDeclarations<true>(true, firstUARule, lastUARule);
-    
-    // If our font got dirtied, go ahead and update it now.
-    if (m_fontDirty)
-        updateFont();
-
-    // Line-height is set when we are sure we decided on the font-size
-    if (m_lineHeightValue)
-        applyProperty(CSSPropertyLineHeight, m_lineHeightValue);
 
-    // Now do the normal priority UA properties.
-    applyDeclarations<false>(false, firstUARule, lastUARule);
-    
-    // Cache our border and background so that we can examine them later.
-    cacheBorderAndBackground();
-    
-    // Now do the author and user normal priority properties and all the !important properties.
-    if (!resolveForRootDefault) {
-        applyDeclarations<false>(false, lastUARule + 1, m_matchedDecls.size() - 1);
-        applyDeclarations<false>(true, firstAuthorRule, lastAuthorRule);
-        applyDeclarations<false>(true, firstUserRule, lastUserRule);
-    }
-    applyDeclarations<false>(true, firstUARule, lastUARule);
+    MatchedDeclarationRanges ranges(firstUARule, lastUARule, firstUserRule, lastUserRule, firstAuthorRule, lastAuthorRule);
+    bool useCache = !resolveForRootDefault && !matchVisitedPseudoClass && canUseMatchedDeclarationCache(e);
+    applyMatchedDeclarations(ranges, resolveForRootDefault, useCache);
 
-    ASSERT(!m_fontDirty);
-    // If our font got dirtied by one of the non-essential font props, 
-    // go ahead and update it a second time.
-    if (m_fontDirty)
-        updateFont();
-    
     // Clean up our style object's display and text decorations (among other fixups).
     adjustRenderStyle(style(), m_parentStyle, e);
 
-    // Start loading images referenced by this style.
-    loadPendingImages();
+    m_style->shareDataWithEqualStyles();
 
     // If we have first-letter pseudo style, do not share this style
     if (m_style->hasPseudoStyle(FIRST_LETTER))
@@ -2042,6 +2026,37 @@ PassRefPtr<CSSRuleList> CSSStyleSelector::pseudoStyleRulesForElement(Element* e,
     return m_ruleList.release();
 }
 
+static inline bool selectorTagMatches(const Element* element, const CSSSelector* selector)
+{
+    if (!selector->hasTag())
+        return true;
+    const AtomicString& localName = selector->tag().localName();
+    if (localName != starAtom && localName != element->localName())
+        return false;
+    const AtomicString& namespaceURI = selector->tag().namespaceURI();
+    return namespaceURI == starAtom || namespaceURI == element->namespaceURI();
+}
+
+// Checks the tag, ids and classes of the subject compound selector only. This is enough to reject most
+// candidate rules without entering the recursive checker and its per-selector bookkeeping.
+static inline bool subjectTagIdsAndClassesMatch(const CSSSelector* selector, const Element* element)
+{
+    if (!selectorTagMatches(element, selector))
+        return false;
+    while (true) {
+        if (selector->m_match == CSSSelector::Class) {
+            if (!element->hasClass() || !static_cast<const StyledElement*>(element)->classNames().contains(selector->value()))
+                return false;
+        } else if (selector->m_match == CSSSelector::Id) {
+            if (!element->hasID() || element->idForStyleResolution() != selector->value())
+                return false;
+        }
+        if (selector->relation() != CSSSelector::SubSelector)
+            return true;
+        selector = selector->tagHistory();
+    }
+}
+
 inline bool CSSStyleSelector::checkSelector(const RuleData& ruleData)
 {
     m_dynamicPseudo = NOPSEUDO;
@@ -2059,6 +2074,8 @@ inline bool CSSStyleSelector::checkSelector(const RuleData& ruleData)
     }
 
     // Slow path.
+    if (ruleData.hasSubjectFastReject() && !subjectTagIdsAndClassesMatch(ruleData.selector(), m_element))
+        return false;
     SelectorMatch match = m_checker.checkSelector(ruleData.selector(), m_element, &m_selectorAttrs, m_dynamicPseudo, false, false, style(), m_parentNode ? m_parentNode->renderStyle() : 0);
     if (match != SelectorMatches)
         return false;
@@ -2067,17 +2084,6 @@ inline bool CSSStyleSelector::checkSelector(const RuleData& ruleData)
     return true;
 }
 
-static inline bool selectorTagMatches(const Element* element, const CSSSelector* selector)
-{
-    if (!selector->hasTag())
-        return true;
-    const AtomicString& localName = selector->tag().localName();
-    if (localName != starAtom && localName != element->localName())
-        return false;
-    const AtomicString& namespaceURI = selector->tag().namespaceURI();
-    return namespaceURI == starAtom || namespaceURI == element->namespaceURI();
-}
-
 static inline bool isFastCheckableSelector(const CSSSelector* selector)
 {
     for (; selector; selector = selector->tagHistory()) {
@@ -2088,6 +2094,22 @@ static inline bool isFastCheckableSelector(const CSSSelector* selector)
     }
     return true;
 }
+
+static inline bool hasSubjectFastReject(const CSSSelector* selector)
+{
+    // Fast checkable selectors never reach the slow path the subject fast reject guards.
+    if (isFastCheckableSelector(selector))
+        return false;
+    // The rule hash has already matched the first id, class or tag, so only what the hash did not cover is worth checking.
+    if (selector->hasTag() && (selector->m_match == CSSSelector::Id || selector->m_match == CSSSelector::Class))
+        return true;
+    while (selector->relation() == CSSSelector::SubSelector) {
+        selector = selector->tagHistory();
+        if (selector->m_match == CSSSelector::Id || selector->m_match == CSSSelector::Class)
+            return true;
+    }
+    return false;
+}
     
 template <class ValueChecker>
 inline bool fastCheckSingleSelector(const CSSSelector*& selector, const Element*& element, const CSSSelector*& topChildOrSubselector, const Element*& topChildOrSubselectorMatchElement)
@@ -3053,6 +3075,7 @@ RuleData::RuleData(CSSStyleRule* rule, CSSSelector* selector, unsigned position)
     , m_hasFastCheckableSelector(isFastCheckableSelector(selector))
     , m_hasMultipartSelector(selector->tagHistory())
     , m_hasTopSelectorMatchingHTMLBasedOnRuleHash(isSelectorMatchingHTMLBasedOnRuleHash(selector))
+    , m_hasSubjectFastReject(hasSubjectFastReject(selector))
 {
     collectDescendantSelectorIdentifierHashes();
 }
@@ -3129,6 +3152,8 @@ void RuleSet::addToRuleSet(AtomicStringImpl* key, AtomRuleMap& map,
 
 void RuleSet::addRule(CSSStyleRule* rule, CSSSelector* sel)
 {
+    collectInvalidationFeatures(sel);
+
     if (sel->m_match == CSSSelector::Id) {
         addToRuleSet(sel->value().impl(), m_idRules, rule, sel);
         return;
@@ -3152,6 +3177,51 @@ void RuleSet::addRule(CSSStyleRule* rule, CSSSelector* sel)
     m_universalRules.append(RuleData(rule, sel, m_ruleCount++));
 }
 
+void RuleSet::addInvalidationFeature(SelectorFeatureMap& map, AtomicStringImpl* key, bool isSubject)
+{
+    if (!key)
+        return;
+    pair<SelectorFeatureMap::iterator, bool> result = map.add(key, !isSubject);
+    if (!isSubject)
+        result.first->second = true;
+}
+
+void RuleSet::collectInvalidationFeaturesFromSimpleSelector(const CSSSelector* selector, bool isSubject)
+{
+    if (selector->m_match == CSSSelector::Class)
+        addInvalidationFeature(m_classesInRules, selector->value().impl(), isSubject);
+    else if (selector->m_match == CSSSelector::Id)
+        addInvalidationFeature(m_idsInRules, selector->value().impl(), isSubject);
+    else if (selector->hasAttribute())
+        addInvalidationFeature(m_attributesInRules, selector->attribute().localName().impl(), isSubject);
+
+    // The compound selectors inside :not() and :-webkit-any() apply to the same element as the selector holding them.
+    if (CSSSelectorList* selectorList = selector->selectorList()) {
+        for (CSSSelector* subSelector = selectorList->first(); subSelector; subSelector = CSSSelectorList::next(subSelector)) {
+            for (CSSSelector* simpleSelector = subSelector; simpleSelector; simpleSelector = simpleSelector->tagHistory())
+                collectInvalidationFeaturesFromSimpleSelector(simpleSelector, isSubject);
+        }
+    }
+}
+
+void RuleSet::collectInvalidationFeatures(const CSSSelector* selector)
+{
+    bool isSubject = true;
+    for (; selector; selector = selector->tagHistory()) {
+        collectInvalidationFeaturesFromSimpleSelector(selector, isSubject);
+        if (selector->relation() != CSSSelector::SubSelector)
+            isSubject = false;
+    }
+}
+
+CSSStyleSelector::InvalidationScope RuleSet::invalidationScope(const SelectorFeatureMap& map, AtomicStringImpl* key)
+{
+    SelectorFeatureMap::const_iterator it = map.find(key);
+    if (it == map.end())
+        return CSSStyleSelector::InvalidatesNothing;
+    return it->second ? CSSStyleSelector::InvalidatesSubtree : CSSStyleSelector::InvalidatesElement;
+}
+
 void RuleSet::addPageRule(CSSStyleRule* rule, CSSSelector* sel)
 {
     m_pageRules.append(RuleData(rule, sel, m_pageRules.size()));
@@ -3347,7 +3417,7 @@ static Length convertToFloatLength(CSSPrimitiveValue* primitiveValue, RenderStyl
 }
 
 template <bool applyFirst>
-void CSSStyleSelector::applyDeclarations(bool isImportant, int startIndex, int endIndex)
+void CSSStyleSelector::applyDeclarations(bool isImportant, int startIndex, int endIndex, bool inheritedOnly)
 {
     if (startIndex == -1)
         return;
@@ -3374,6 +3444,10 @@ void CSSStyleSelector::applyDeclarations(bool isImportant, int startIndex, int e
                             applyProperty(current.id(), current.value());
                     }
                 } else {
+                    // The high-priority properties are always applied; they are few, and a matched
+                    // declaration cache hit needs them to tell whether its other data can be reused.
+                    if (inheritedOnly && !CSSProperty::isInheritedProperty(property))
+                        continue;
                     if (property > CSSPropertyLineHeight)
                         applyProperty(current.id(), current.value());
                 }
@@ -3548,6 +3622,180 @@ static inline bool useSVGZoomRules(const Element* e)
     return e && e->isSVGElement();
 }
 
+static CSSStyleSelector::MatchedDeclarationCacheStatistics gMatchedDeclarationCacheStatistics;
+
+CSSStyleSelector::MatchedDeclarationCacheStatistics CSSStyleSelector::matchedDeclarationCacheStatistics()
+{
+    return gMatchedDeclarationCacheStatistics;
+}
+
+bool CSSStyleSelector::canUseMatchedDeclarationCache(Element* e) const
+{
+    // Without a parent style the element inherits from itself, and the root element style feeds rem units everywhere else.
+    if (m_parentStyle == m_style.get() || e == e->document()->documentElement() || !m_rootElementStyle)
+        return false;
+    // Link styles depend on the visited state, which is not part of the matched declarations.
+    if (e->isLink())
+        return false;
+    // Font sizes are computed differently for SVG elements.
+    if (useSVGZoomRules(e))
+        return false;
+    // The inline style declaration is edited in place, so its pointer does not identify its contents.
+    if (m_styledElement && m_styledElement->inlineStyleDecl())
+        return false;
+    return true;
+}
+
+bool CSSStyleSelector::isCacheableInMatchedDeclarationCache() const
+{
+    // Unique styles depend on the element itself, for example through attr() in content.
+    if (m_style->unique())
+        return false;
+    // Themed controls are adjusted against the cached border and background.
+    if (m_style->hasAppearance())
+        return false;
+    if (m_style->zoom() != RenderStyle::initialZoom())
+        return false;
+    // Explicitly inheriting a non-inherited property makes the style depend on parent data
+    // that inheritedDataShared() does not look at.
+    if (m_parentStyle->hasExplicitlyInheritedProperties())
+        return false;
+    return true;
+}
+
+unsigned CSSStyleSelector::computeMatchedDeclarationHash() const
+{
+    ASSERT(sizeof(CSSMutableStyleDeclaration*) % 2 == 0);
+    return StringHasher::hashMemory(m_matchedDecls.data(), m_matchedDecls.size() * sizeof(CSSMutableStyleDeclaration*));
+}
+
+const CSSStyleSelector::MatchedDeclarationCacheItem* CSSStyleSelector::findFromMatchedDeclarationCache(unsigned hash, const MatchedDeclarationRanges& ranges) const
+{
+    ASSERT(hash);
+
+    MatchedDeclarationCache::const_iterator it = m_matchedDeclarationCache.find(hash);
+    if (it == m_matchedDeclarationCache.end())
+        return 0;
+    const MatchedDeclarationCacheItem& cacheItem = it->second;
+
+    size_t size = m_matchedDecls.size();
+    if (size != cacheItem.declarations.size())
+        return 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (m_matchedDecls[i] != cacheItem.declarations[i])
+            return 0;
+    }
+    if (!(ranges == cacheItem.ranges))
+        return 0;
+    if (m_rootElementStyle->fontDescription() != cacheItem.rootElementFontDescription)
+        return 0;
+    return &cacheItem;
+}
+
+void CSSStyleSelector::addToMatchedDeclarationCache(unsigned hash, const MatchedDeclarationRanges& ranges)
+{
+    static const unsigned maxMatchedDeclarationCacheSize = 1024;
+    if (m_matchedDeclarationCache.size() >= maxMatchedDeclarationCacheSize)
+        m_matchedDeclarationCache.clear();
+
+    MatchedDeclarationCacheItem cacheItem;
+    cacheItem.declarations.reserveInitialCapacity(m_matchedDecls.size());
+    for (size_t i = 0; i < m_matchedDecls.size(); ++i)
+        cacheItem.declarations.uncheckedAppend(m_matchedDecls[i]);
+    cacheItem.ranges = ranges;
+    // Clone so the cached copies are not changed by later in-place adjustments of the originals.
+    cacheItem.renderStyle = RenderStyle::clone(m_style.get());
+    cacheItem.parentRenderStyle = RenderStyle::clone(m_parentStyle);
+    cacheItem.rootElementFontDescription = m_rootElementStyle->fontDescription();
+    m_matchedDeclarationCache.set(hash, cacheItem);
+}
+
+void CSSStyleSelector::applyMatchedDeclarations(const MatchedDeclarationRanges& ranges, bool resolveForRootDefault, bool useCache)
+{
+    unsigned cacheHash = useCache ? computeMatchedDeclarationHash() : 0;
+    const MatchedDeclarationCacheItem* cacheItem = cacheHash ? findFromMatchedDeclarationCache(cacheHash, ranges) : 0;
+    bool applyInheritedOnly = false;
+    if (cacheHash)
+        ++gMatchedDeclarationCacheStatistics.lookups;
+
+    if (cacheItem) {
+        // An earlier element matched exactly the same declarations, so its non-inherited data can be
+        // copied as is. Only inherited properties may come out differently, and not even those when
+        // the parent shares its inherited data with the parent of the earlier element.
+        m_style->copyNonInheritedFrom(cacheItem->renderStyle.get());
+        if (m_parentStyle->inheritedDataShared(cacheItem->parentRenderStyle.get())) {
+            EInsideLink linkStatus = m_style->insideLink();
+            m_style->inheritFrom(cacheItem->renderStyle.get());
+            // The link state is kept with the inherited flags but belongs to this element.
+            m_style->setInsideLink(linkStatus);
+            ++gMatchedDeclarationCacheStatistics.sharedHits;
+            return;
+        }
+        applyInheritedOnly = true;
+        ++gMatchedDeclarationCacheStatistics.inheritedHits;
+    }
+
+    // Now we have all of the matched rules in the appropriate order.  Walk the rules and apply
+    // high-priority properties first, i.e., those properties that other properties depend on.
+    // The order is (1) high-priority not important, (2) high-priority important, (3) normal not important
+    // and (4) normal important.
+    m_lineHeightValue = 0;
+    applyDeclarations<true>(false, 0, m_matchedDecls.size() - 1);
+    if (!resolveForRootDefault) {
+        applyDeclarations<true>(true, ranges.firstAuthorRule, ranges.lastAuthorRule);
+        applyDeclarations<true>(true, ranges.firstUserRule, ranges.lastUserRule);
+    }
+    applyDeclarations<true>(true, ranges.firstUARule, ranges.lastUARule);
+    
+    // If our font got dirtied, go ahead and update it now.
+    if (m_fontDirty)
+        updateFont();
+
+    // Line-height is set when we are sure we decided on the font-size
+    if (m_lineHeightValue)
+        applyProperty(CSSPropertyLineHeight, m_lineHeightValue);
+
+    // The copied non-inherited lengths were computed against the font, zoom and writing mode of the
+    // cached style; if any of those differ, the remaining properties have to be applied after all.
+    if (cacheItem) {
+        RenderStyle* cachedStyle = cacheItem->renderStyle.get();
+        if (cachedStyle->fontDescription() != m_style->fontDescription() || cachedStyle->effectiveZoom() != m_style->effectiveZoom()
+            || cachedStyle->direction() != m_style->direction() || cachedStyle->writingMode() != m_style->writingMode()) {
+            applyInheritedOnly = false;
+            ++gMatchedDeclarationCacheStatistics.fontMismatches;
+        }
+    }
+
+    // Now do the normal priority UA properties.
+    applyDeclarations<false>(false, ranges.firstUARule, ranges.lastUARule, applyInheritedOnly);
+    
+    // Cache our border and background so that we can examine them later.
+    cacheBorderAndBackground();
+    
+    // Now do the author and user normal priority properties and all the !important properties.
+    if (!resolveForRootDefault) {
+        applyDeclarations<false>(false, ranges.lastUARule + 1, m_matchedDecls.size() - 1, applyInheritedOnly);
+        applyDeclarations<false>(true, ranges.firstAuthorRule, ranges.lastAuthorRule, applyInheritedOnly);
+        applyDeclarations<false>(true, ranges.firstUserRule, ranges.lastUserRule, applyInheritedOnly);
+    }
+    applyDeclarations<false>(true, ranges.firstUARule, ranges.lastUARule, applyInheritedOnly);
+
+    ASSERT(!m_fontDirty);
+    // If our font got dirtied by one of the non-essential font props, 
+    // go ahead and update it a second time.
+    if (m_fontDirty)
+        updateFont();
+
+    // Start loading images referenced by this style. This happens before the style is cached
+    // so that later copies do not pick up images that are still pending.
+    loadPendingImages();
+
+    if (!cacheItem && cacheHash && isCacheableInMatchedDeclarationCache()) {
+        addToMatchedDeclarationCache(cacheHash, ranges);
+        ++gMatchedDeclarationCacheStatistics.additions;
+    }
+}
+
 void CSSStyleSelector::applyProperty(int id, CSSValue *value)
 {
     CSSPrimitiveValue* primitiveValue = 0;
@@ -3570,6 +3818,9 @@ void CSSStyleSelector::applyProperty(int id, CSSValue *value)
         // Limit the properties that can be applied to only the ones honored by :visited.
         return;
     }
+
+    if (isInherit && m_parentStyle && !m_parentStyle->hasExplicitlyInheritedProperties() && !CSSProperty::isInheritedProperty(id))
+        m_parentStyle->setHasExplicitlyInheritedProperties();
     
     CSSPropertyID property = static_cast<CSSPropertyID>(id);
 
@@ -7015,7 +7266,39 @@ Color CSSStyleSelector::getColorFromPrimitiveValue(CSSPrimitiveValue* primitiveV
 
 bool CSSStyleSelector::hasSelectorForAttribute(const AtomicString &attrname) const
 {
-    return m_selectorAttrs.contains(attrname.impl());
+    return m_selectorAttrs.contains(attrname.impl()) || invalidationScopeForAttribute(attrname) != InvalidatesNothing;
+}
+
+template <CSSStyleSelector::InvalidationScope (RuleSet::*scopeInRuleSet)(AtomicStringImpl*) const>
+static inline CSSStyleSelector::InvalidationScope invalidationScopeInRuleSets(const RuleSet* authorStyle, const RuleSet* userStyle, AtomicStringImpl* key)
+{
+    // The default sheets in use are not tracked per document, so all of them are consulted.
+    const RuleSet* ruleSets[] = { authorStyle, userStyle, defaultStyle, defaultQuirksStyle, defaultPrintStyle, defaultViewSourceStyle };
+    CSSStyleSelector::InvalidationScope scope = CSSStyleSelector::InvalidatesNothing;
+    for (size_t i = 0; i < WTF_ARRAY_LENGTH(ruleSets) && scope != CSSStyleSelector::InvalidatesSubtree; ++i) {
+        if (ruleSets[i])
+            scope = max(scope, (ruleSets[i]->*scopeInRuleSet)(key));
+    }
+    return scope;
+}
+
+CSSStyleSelector::InvalidationScope CSSStyleSelector::invalidationScopeForClass(const AtomicString& className) const
+{
+    return invalidationScopeInRuleSets<&RuleSet::invalidationScopeForClass>(m_authorStyle.get(), m_userStyle.get(), className.impl());
+}
+
+CSSStyleSelector::InvalidationScope CSSStyleSelector::invalidationScopeForId(const AtomicString& id) const
+{
+    return invalidationScopeInRuleSets<&RuleSet::invalidationScopeForId>(m_authorStyle.get(), m_userStyle.get(), id.impl());
+}
+
+CSSStyleSelector::InvalidationScope CSSStyleSelector::invalidationScopeForAttribute(const AtomicString& localName) const
+{
+    InvalidationScope scope = invalidationScopeInRuleSets<&RuleSet::invalidationScopeForAttribute>(m_authorStyle.get(), m_userStyle.get(), localName.impl());
+    // Attributes read by attr() in generated content are only found while resolving styles.
+    if (scope == InvalidatesNothing && m_selectorAttrs.contains(localName.impl()))
+        scope = InvalidatesElement;
+    return scope;
 }
 
 void CSSStyleSelector::addViewportDependentMediaQueryResult(const MediaQueryExp* expr, bool result)
@@ -165,6 +165,13 @@ public:
         Color getColorFromPrimitiveValue(CSSPrimitiveValue*) const;
 
         bool hasSelectorForAttribute(const AtomicString&) const;
+
+        // How far a change of a class, id or attribute on one element can reach, judging from where the
+        // selectors use it: not at all, only the element itself, or also its descendants and siblings.
+        enum InvalidationScope { InvalidatesNothing, InvalidatesElement, InvalidatesSubtree };
+        InvalidationScope invalidationScopeForClass(const AtomicString& className) const;
+        InvalidationScope invalidationScopeForId(const AtomicString&) const;
+        InvalidationScope invalidationScopeForAttribute(const AtomicString& localName) const;
  
         CSSFontSelector* fontSelector() const { return m_fontSelector.get(); }
 
@@ -172,6 +179,23 @@ public:
 
         bool affectedByViewportChange() const;
 
+        // Drops styles remembered for reuse; needed when something outside the matched
+        // declarations, like the available fonts, changes what they compute to.
+        void clearMatchedDeclarationCache() { m_matchedDeclarationCache.clear(); }
+
+        // Totals over all style selectors in the process.
+        struct MatchedDeclarationCacheStatistics {
+            unsigned lookups;
+            // Hits that could also take the inherited data from the cached style.
+            unsigned sharedHits;
+            // Hits that had to apply the inherited properties again.
+            unsigned inheritedHits;
+            // Hits whose font, zoom or writing mode differed, so that every property was applied after all.
+            unsigned fontMismatches;
+            unsigned additions;
+        };
+        static MatchedDeclarationCacheStatistics matchedDeclarationCacheStatistics();
+
         void allVisitedStateChanged() { m_checker.allVisitedStateChanged(); }
         void visitedStateChanged(LinkHash visitedHash) { m_checker.visitedStateChanged(visitedHash); }
 
@@ -216,7 +240,49 @@ public:
         bool checkSelector(const RuleData&);
 
         template <bool firstPass>
-        void applyDeclarations(bool important, int startIndex, int endIndex);
+        void applyDeclarations(bool important, int startIndex, int endIndex, bool inheritedOnly = false);
+
+        struct MatchedDeclarationRanges {
+            MatchedDeclarationRanges(int firstUARule, int lastUARule, int firstUserRule, int lastUserRule, int firstAuthorRule, int lastAuthorRule)
+                : firstUARule(firstUARule), lastUARule(lastUARule)
+                , firstUserRule(firstUserRule), lastUserRule(lastUserRule)
+                , firstAuthorRule(firstAuthorRule), lastAuthorRule(lastAuthorRule)
+            {
+            }
+            bool operator==(const MatchedDeclarationRanges& o) const
+            {
+                return firstUARule == o.firstUARule && lastUARule == o.lastUARule
+                    && firstUserRule == o.firstUserRule && lastUserRule == o.lastUserRule
+                    && firstAuthorRule == o.firstAuthorRule && lastAuthorRule == o.lastAuthorRule;
+            }
+
+            int firstUARule;
+            int lastUARule;
+            int firstUserRule;
+            int lastUserRule;
+            int firstAuthorRule;
+            int lastAuthorRule;
+        };
+
+        // A style computed from a list of matched declarations, kept so that later elements
+        // matching the very same list can copy its data instead of applying every property again.
+        struct MatchedDeclarationCacheItem {
+            MatchedDeclarationCacheItem() : ranges(-1, -1, -1, -1, -1, -1) { }
+
+            Vector<RefPtr<CSSMutableStyleDeclaration> > declarations;
+            MatchedDeclarationRanges ranges;
+            RefPtr<RenderStyle> renderStyle;
+            RefPtr<RenderStyle> parentRenderStyle;
+            // Lengths in rem units depend on the root element font.
+            FontDescription rootElementFontDescription;
+        };
+
+        void applyMatchedDeclarations(const MatchedDeclarationRanges&, bool resolveForRootDefault, bool useCache);
+        bool canUseMatchedDeclarationCache(Element*) const;
+        bool isCacheableInMatchedDeclarationCache() const;
+        unsigned computeMatchedDeclarationHash() const;
+        const MatchedDeclarationCacheItem* findFromMatchedDeclarationCache(unsigned hash, const MatchedDeclarationRanges&) const;
+        void addToMatchedDeclarationCache(unsigned hash, const MatchedDeclarationRanges&);
 
         void matchPageRules(RuleSet*, bool isLeftPage, bool isFirstPage, const String& pageName);
         void matchPageRulesForList(const Vector<RuleData>*, bool isLeftPage, bool isFirstPage, const String& pageName);
@@ -360,6 +426,9 @@ public:
         Vector<CSSMutableStyleDeclaration*> m_additionalAttributeStyleDecls;
         Vector<MediaQueryResult*> m_viewportDependentMediaQueryResults;
 
+        typedef HashMap<unsigned, MatchedDeclarationCacheItem> MatchedDeclarationCache;
+        MatchedDeclarationCache m_matchedDeclarationCache;
+
         const CSSStyleApplyProperty& m_applyProperty;
     };
 
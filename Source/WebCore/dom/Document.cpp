@@ -492,6 +492,7 @@ Document::Document(Frame* frame, const KURL& url, bool isXHTML, bool isHTML)
     setInDocument();
     m_inStyleRecalc = false;
     m_closeAfterStyleRecalc = false;
+    m_elementStyleRecalcCount = 0;
 
     m_usesSiblingRules = false;
     m_usesSiblingRulesOverride = false;
@@ -1507,6 +1508,10 @@ void Document::recalcStyle(StyleChange change)
     if (change == Force) {
         // style selector may set this again during recalc
         m_hasNodesWithPlaceholderStyle = false;
+
+        // A forced recalc means something besides the matched declarations changed, like fonts or zoom.
+        if (m_styleSelector)
+            m_styleSelector->clearMatchedDeclarationCache();
         
         RefPtr<RenderStyle> documentStyle = CSSStyleSelector::styleForDocument(this);
         StyleChange ch = diff(documentStyle.get(), renderer()->style());
@@ -914,6 +914,11 @@ public:
     unsigned styleVersion() const { return m_styleVersion; }
 #endif
 
+    // The number of times Element::recalcStyle() has resolved an element's style, so that tests can
+    // check how much of the tree a change restyled.
+    void didRecalcElementStyle() { ++m_elementStyleRecalcCount; }
+    unsigned elementStyleRecalcCount() const { return m_elementStyleRecalcCount; }
+
     void setDocType(PassRefPtr<DocumentType>);
 
 #if ENABLE(XPATH)
@@ -1282,6 +1287,7 @@ private:
     bool m_pendingStyleRecalcShouldForce;
     bool m_inStyleRecalc;
     bool m_closeAfterStyleRecalc;
+    unsigned m_elementStyleRecalcCount;
 
     bool m_usesSiblingRules;
     bool m_usesSiblingRulesOverride;
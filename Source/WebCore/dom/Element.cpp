@@ -767,12 +767,18 @@ void Element::updateAfterAttributeChanged(Attribute* attr)
     
 void Element::recalcStyleIfNeededAfterAttributeChanged(Attribute* attr)
 {
-    if (document()->attached() && document()->styleSelector()->hasSelectorForAttribute(attr->name().localName()))
+    if (!document()->attached())
+        return;
+    CSSStyleSelector::InvalidationScope scope = document()->styleSelector()->invalidationScopeForAttribute(attr->name().localName());
+    if (scope == CSSStyleSelector::InvalidatesSubtree)
         setNeedsStyleRecalc();
+    else if (scope == CSSStyleSelector::InvalidatesElement)
+        setNeedsStyleRecalc(InlineStyleChange);
 }
 
 void Element::idAttributeChanged(Attribute* attr)
 {
+    AtomicString oldId = hasID() && attributeMap() ? attributeMap()->idForStyleResolution() : nullAtom;
     setHasID(!attr->isNull());
     if (attributeMap()) {
         if (attr->isNull())
@@ -782,7 +788,19 @@ void Element::idAttributeChanged(Attribute* attr)
         else
             attributeMap()->setIdForStyleResolution(attr->value());
     }
-    setNeedsStyleRecalc();
+
+    if (!attached())
+        return;
+    AtomicString newId = hasID() && attributeMap() ? attributeMap()->idForStyleResolution() : nullAtom;
+    if (oldId == newId)
+        return;
+    CSSStyleSelector* styleSelector = document()->styleSelector();
+    CSSStyleSelector::InvalidationScope scope = std::max(oldId.isNull() ? CSSStyleSelector::InvalidatesNothing : styleSelector->invalidationScopeForId(oldId),
+        newId.isNull() ? CSSStyleSelector::InvalidatesNothing : styleSelector->invalidationScopeForId(newId));
+    if (scope == CSSStyleSelector::InvalidatesSubtree)
+        setNeedsStyleRecalc();
+    else if (scope == CSSStyleSelector::InvalidatesElement)
+        setNeedsStyleRecalc(InlineStyleChange);
 }
     
 // Returns true is the given attribute is an event handler.
@@ -1101,6 +1119,7 @@ void Element::recalcStyle(StyleChange change)
             rareData()->resetComputedStyle();
     }
     if (hasParentStyle && (change >= Inherit || needsStyleRecalc())) {
+        document()->didRecalcElementStyle();
         RefPtr<RenderStyle> newStyle = document()->styleSelector()->styleForElement(this);
         StyleChange ch = diff(currentStyle.get(), newStyle.get());
         if (ch == Detach || !currentStyle) {
@@ -1153,6 +1172,10 @@ void Element::recalcStyle(StyleChange change)
                 change = Force;
             else if (styleChangeType() >= FullStyleChange)
                 change = Force;
+            // Children that explicitly inherit non-inherited properties, like margin: inherit, have to pick up
+            // the new values even though none of the inherited properties changed.
+            else if (ch == NoInherit && currentStyle && currentStyle->hasExplicitlyInheritedProperties())
+                change = Inherit;
             else
                 change = ch;
         }
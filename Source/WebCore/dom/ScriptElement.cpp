@@ -219,6 +219,7 @@ bool ScriptElement::prepareScript(const TextPosition1& scriptStartPosition, Lega
             return false;
 
     if (hasSourceAttribute() && deferAttributeValue() && m_parserInserted && !asyncAttributeValue()) {
+        m_cachedScript->allowBackgroundDecoding();
         m_willExecuteWhenDocumentFinishedParsing = true;
         m_willBeParserExecuted = true;
     } else if (hasSourceAttribute() && m_parserInserted && !asyncAttributeValue())
@@ -230,9 +231,10 @@ bool ScriptElement::prepareScript(const TextPosition1& scriptStartPosition, Lega
         m_willExecuteInOrder = true;
         m_element->document()->scriptRunner()->queueScriptForExecution(this, m_cachedScript, ScriptRunner::IN_ORDER_EXECUTION);
         m_cachedScript->addClient(this);
-    } else if (hasSourceAttribute())
+    } else if (hasSourceAttribute()) {
+        m_cachedScript->allowBackgroundDecoding();
         m_cachedScript->addClient(this);
-    else
+    } else
         executeScript(ScriptSourceCode(scriptContent(), m_element->document()->url(), scriptStartPosition));
 
     return true;
@@ -300,6 +302,8 @@ void ScriptElement::execute(CachedScript* cachedScript)
     if (cachedScript->errorOccurred())
         dispatchErrorEvent();
     else {
+        if (Page* page = m_element->document()->page())
+            cachedScript->script(&page->scriptDecodingStatistics());
         executeScript(ScriptSourceCode(cachedScript));
         dispatchLoadEvent();
     }
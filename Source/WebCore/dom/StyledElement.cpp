@@ -210,8 +210,38 @@ bool StyledElement::mapToEntry(const QualifiedName& attrName, MappedAttributeEnt
     return true;
 }
 
+typedef Vector<AtomicString, 8> ClassNameVector;
+
+static void appendClassNames(const StyledElement* element, ClassNameVector& classNames)
+{
+    if (!element->hasClass())
+        return;
+    const SpaceSplitString& names = element->classNames();
+    for (size_t i = 0; i < names.size(); ++i)
+        classNames.append(names[i]);
+}
+
+// Only the classes that were added or removed can make a selector start or stop matching.
+static CSSStyleSelector::InvalidationScope invalidationScopeForClassChange(CSSStyleSelector* styleSelector, const ClassNameVector& oldClasses, const ClassNameVector& newClasses)
+{
+    CSSStyleSelector::InvalidationScope scope = CSSStyleSelector::InvalidatesNothing;
+    for (size_t i = 0; i < oldClasses.size() && scope != CSSStyleSelector::InvalidatesSubtree; ++i) {
+        if (!newClasses.contains(oldClasses[i]))
+            scope = max(scope, styleSelector->invalidationScopeForClass(oldClasses[i]));
+    }
+    for (size_t i = 0; i < newClasses.size() && scope != CSSStyleSelector::InvalidatesSubtree; ++i) {
+        if (!oldClasses.contains(newClasses[i]))
+            scope = max(scope, styleSelector->invalidationScopeForClass(newClasses[i]));
+    }
+    return scope;
+}
+
 void StyledElement::classAttributeChanged(const AtomicString& newClassString)
 {
+    ClassNameVector oldClasses;
+    if (attached())
+        appendClassNames(this, oldClasses);
+
     const UChar* characters = newClassString.characters();
     unsigned length = newClassString.length();
     unsigned i;
@@ -227,7 +257,16 @@ void StyledElement::classAttributeChanged(const AtomicString& newClassString)
             static_cast<ClassList*>(classList)->reset(newClassString);
     } else if (attributeMap())
         attributeMap()->clearClass();
-    setNeedsStyleRecalc();
+
+    if (attached()) {
+        ClassNameVector newClasses;
+        appendClassNames(this, newClasses);
+        CSSStyleSelector::InvalidationScope scope = invalidationScopeForClassChange(document()->styleSelector(), oldClasses, newClasses);
+        if (scope == CSSStyleSelector::InvalidatesSubtree)
+            setNeedsStyleRecalc();
+        else if (scope == CSSStyleSelector::InvalidatesElement)
+            setNeedsStyleRecalc(InlineStyleChange); // Recomputes this element, and its children only if inherited values change.
+    }
     dispatchSubtreeModifiedEvent();
 }
 
@@ -39,6 +39,7 @@
 #include "IgnoreDestructiveWriteCountIncrementer.h"
 #include "NestingLevelIncrementer.h"
 #include "NotImplemented.h"
+#include "Page.h"
 #include "ScriptElement.h"
 #include "ScriptSourceCode.h"
 
@@ -101,6 +102,8 @@ ScriptSourceCode HTMLScriptRunner::sourceFromPendingScript(const PendingScript&
     if (script.cachedScript()) {
         errorOccurred = script.cachedScript()->errorOccurred();
         ASSERT(script.cachedScript()->isLoaded());
+        if (Page* page = m_document->page())
+            script.cachedScript()->script(&page->scriptDecodingStatistics());
         return ScriptSourceCode(script.cachedScript());
     }
     errorOccurred = false;
@@ -95,15 +95,26 @@ void CachedCSSStyleSheet::data(PassRefPtr<SharedBuffer> data, bool allDataReceiv
 
     m_data = data;
     setEncodedSize(m_data.get() ? m_data->size() : 0);
-    // Decode the data to find out the encoding and keep the sheet text around during checkNotify()
+    // Decode the data to find out the encoding. The decoded text is kept as decoded data: style rules parsed
+    // from it refer to their declaration text in place, so every document using this sheet shares one copy.
     if (m_data) {
         m_decodedSheetText = m_decoder->decode(m_data->data(), m_data->size());
         m_decodedSheetText += m_decoder->flush();
+        setDecodedSize(m_decodedSheetText.length() * sizeof(UChar));
     }
     setLoading(false);
     checkNotify();
-    // Clear the decoded text as it is unlikely to be needed immediately again and is cheap to regenerate.
+}
+
+void CachedCSSStyleSheet::destroyDecodedData()
+{
+    // Style rules whose declarations have not been parsed yet refer to their text in place. While any
+    // do, dropping the text would free nothing, only keep later documents from sharing it, and have the
+    // memory cache count memory as freed that is still in use.
+    if (m_decodedSheetText.impl() && !m_decodedSheetText.impl()->hasOneRef())
+        return;
     m_decodedSheetText = String();
+    setDecodedSize(0);
 }
 
 void CachedCSSStyleSheet::checkNotify()
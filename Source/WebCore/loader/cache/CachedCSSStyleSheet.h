@@ -50,6 +50,7 @@ namespace WebCore {
         virtual String encoding() const;
         virtual void data(PassRefPtr<SharedBuffer> data, bool allDataReceived);
         virtual void error(CachedResource::Status);
+        virtual void destroyDecodedData();
 
         void checkNotify();
     
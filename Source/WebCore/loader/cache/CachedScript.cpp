@@ -30,20 +30,194 @@
 #include "MemoryCache.h"
 #include "CachedResourceClient.h"
 #include "CachedResourceClientWalker.h"
+#include "Logging.h"
 #include "SharedBuffer.h"
 #include "TextResourceDecoder.h"
+#include <wtf/CurrentTime.h>
+#include <wtf/MessageQueue.h>
+#include <wtf/Threading.h>
 #include <wtf/Vector.h>
 
 #if USE(JSC)  
 #include <parser/SourceProvider.h>
 #endif
 
+using std::max;
+
 namespace WebCore {
 
+// Large scripts that will not run as soon as they have loaded (async and deferred scripts, and
+// preloads nobody has asked for yet) are decoded on a helper thread in the meantime, so that the main
+// thread does not have to do it when the script is eventually executed. Small scripts are not worth
+// the thread hop.
+static const unsigned minimumSizeForBackgroundDecoding = 32 * 1024;
+
+class ScriptDecodingJob : public ThreadSafeRefCounted<ScriptDecodingJob> {
+public:
+    // The data is not copied. The caller keeps the buffer alive until cancel() or takeResult() returns.
+    static PassRefPtr<ScriptDecodingJob> create(const char* encodingName, const char* data, size_t length)
+    {
+        return adoptRef(new ScriptDecodingJob(encodingName, data, length));
+    }
+
+    // Called on the decoding thread.
+    void run()
+    {
+        {
+            MutexLocker locker(m_mutex);
+            if (m_state == Cancelled)
+                return;
+            m_state = Running;
+        }
+
+        double startTime = currentTime();
+        RefPtr<TextResourceDecoder> decoder = TextResourceDecoder::create("application/javascript", m_encodingName);
+        String result = decoder->decode(m_data, m_length);
+        result += decoder->flush();
+        double decodingTime = currentTime() - startTime;
+        // Points into the TextEncoding registry, like m_encodingName. A byte order mark in the data
+        // makes it differ from the encoding the job was started with.
+        const char* encodingName = decoder->encoding().name();
+
+        MutexLocker locker(m_mutex);
+        if (m_state == Cancelled) {
+            m_condition.signal();
+            return;
+        }
+        // The result is handed over to the main thread under the lock, so the string's reference
+        // count is never touched by both threads at once.
+        m_result = result;
+        result = String();
+        m_decodingTime = decodingTime;
+        m_encodingName = encodingName;
+        m_state = Finished;
+        m_condition.signal();
+    }
+
+    // Called on the main thread. Waits for a job that is already running, since that is cheaper than
+    // decoding a second time; a job that has not started yet is cancelled and the caller decodes
+    // synchronously instead. waitTime is how long the main thread was blocked.
+    bool takeResult(String& result, const char*& encodingName, double& decodingTime, double& waitTime)
+    {
+        MutexLocker locker(m_mutex);
+        waitTime = 0;
+        if (m_state == Running) {
+            double startTime = currentTime();
+            while (m_state == Running)
+                m_condition.wait(m_mutex);
+            waitTime = currentTime() - startTime;
+        }
+        if (m_state != Finished) {
+            m_state = Cancelled;
+            return false;
+        }
+        result = m_result;
+        encodingName = m_encodingName;
+        decodingTime = m_decodingTime;
+        m_result = String();
+        m_state = Cancelled;
+        return true;
+    }
+
+    // Called on the main thread. Waits for a job that is already running, since it is still reading
+    // the caller's buffer.
+    void cancel()
+    {
+        MutexLocker locker(m_mutex);
+        while (m_state == Running)
+            m_condition.wait(m_mutex);
+        m_result = String();
+        m_state = Cancelled;
+    }
+
+private:
+    enum State { Pending, Running, Finished, Cancelled };
+
+    ScriptDecodingJob(const char* encodingName, const char* data, size_t length)
+        : m_encodingName(encodingName)
+        , m_data(data)
+        , m_length(length)
+        , m_state(Pending)
+        , m_decodingTime(0)
+    {
+    }
+
+    // Points into the TextEncoding registry, so it can be shared between threads. Once the job has
+    // finished, this is the encoding the data was decoded with.
+    const char* m_encodingName;
+    const char* m_data;
+    size_t m_length;
+
+    Mutex m_mutex;
+    ThreadCondition m_condition;
+    State m_state;
+    String m_result;
+    double m_decodingTime;
+};
+
+// A task without a job tells the decoding thread to exit.
+struct ScriptDecodingTask {
+    explicit ScriptDecodingTask(PassRefPtr<ScriptDecodingJob> job)
+        : job(job)
+    {
+    }
+
+    RefPtr<ScriptDecodingJob> job;
+};
+
+static MessageQueue<ScriptDecodingTask>& scriptDecodingQueue()
+{
+    DEFINE_STATIC_LOCAL(MessageQueue<ScriptDecodingTask>, queue, ());
+    return queue;
+}
+
+// The decoding thread only runs while some CachedScript holds a job, so that it is not left idle
+// for the life of the process.
+static ThreadIdentifier scriptDecodingThreadID;
+static unsigned liveScriptDecodingJobCount;
+
+static void* scriptDecodingThreadStart(void*)
+{
+    while (OwnPtr<ScriptDecodingTask> task = scriptDecodingQueue().waitForMessage()) {
+        if (!task->job)
+            break;
+        task->job->run();
+    }
+    return 0;
+}
+
+static void postScriptDecodingJob(PassRefPtr<ScriptDecodingJob> job)
+{
+    ASSERT(isMainThread());
+    // The queue is created here, before the thread that waits on it exists.
+    MessageQueue<ScriptDecodingTask>& queue = scriptDecodingQueue();
+    if (!scriptDecodingThreadID)
+        scriptDecodingThreadID = createThread(scriptDecodingThreadStart, 0, "WebCore: ScriptDecoder");
+    ++liveScriptDecodingJobCount;
+    queue.append(adoptPtr(new ScriptDecodingTask(job)));
+}
+
+// Called once a job posted by postScriptDecodingJob() has been cancelled or its result taken.
+static void scriptDecodingJobDone()
+{
+    ASSERT(isMainThread());
+    ASSERT(liveScriptDecodingJobCount);
+    if (--liveScriptDecodingJobCount || !scriptDecodingThreadID)
+        return;
+
+    // Every job left in the queue has been cancelled and returns straight away, so this does not
+    // wait for any decoding.
+    scriptDecodingQueue().append(adoptPtr(new ScriptDecodingTask(0)));
+    waitForThreadCompletion(scriptDecodingThreadID, 0);
+    scriptDecodingThreadID = 0;
+}
+
 CachedScript::CachedScript(const ResourceRequest& resourceRequest, const String& charset)
     : CachedResource(resourceRequest, Script)
     , m_decoder(TextResourceDecoder::create("application/javascript", charset))
     , m_decodedDataDeletionTimer(this, &CachedScript::decodedDataDeletionTimerFired)
+    , m_pendingDecodedSize(0)
+    , m_backgroundDecodingAllowed(false)
 {
     // It's javascript we want.
     // But some websites think their scripts are <some wrong mimetype here>
@@ -53,6 +227,7 @@ CachedScript::CachedScript(const ResourceRequest& resourceRequest, const String&
 
 CachedScript::~CachedScript()
 {
+    cancelBackgroundDecoding();
 }
 
 void CachedScript::didAddClient(CachedResourceClient* c)
@@ -71,6 +246,7 @@ void CachedScript::allClientsRemoved()
 
 void CachedScript::setEncoding(const String& chs)
 {
+    cancelBackgroundDecoding();
     m_decoder->setEncoding(chs, TextResourceDecoder::EncodingFromHTTPHeader);
 }
 
@@ -79,13 +255,36 @@ String CachedScript::encoding() const
     return m_decoder->encoding().name();
 }
 
-const String& CachedScript::script()
+const String& CachedScript::script(ScriptDecodingStatistics* statistics)
 {
     ASSERT(!isPurgeable());
 
     if (!m_script && m_data) {
-        m_script = m_decoder->decode(m_data->data(), encodedSize());
-        m_script += m_decoder->flush();
+        const char* encodingName = 0;
+        double decodingTime = 0;
+        double waitTime = 0;
+        bool decodedInBackground = m_decodingJob && m_decodingJob->takeResult(m_script, encodingName, decodingTime, waitTime);
+        cancelBackgroundDecoding();
+        if (decodedInBackground) {
+            // m_decoder has not seen the data, so it has not found any byte order mark.
+            if (strcmp(encodingName, m_decoder->encoding().name()))
+                m_decoder->setEncoding(encodingName, TextResourceDecoder::AutoDetectedEncoding);
+            double decodingTimeSaved = max(decodingTime - waitTime, 0.0);
+            LOG(ResourceLoading, "CachedScript %p: %u bytes decoded on the helper thread in %.2f ms, %.2f ms of it spent waiting on the main thread", this, encodedSize(), decodingTime * 1000, waitTime * 1000);
+            if (statistics) {
+                ++statistics->backgroundDecodeCount;
+                statistics->backgroundWaitTime += waitTime;
+                statistics->decodingTimeSaved += decodingTimeSaved;
+            }
+        } else {
+            double startTime = currentTime();
+            m_script = m_decoder->decode(m_data->data(), encodedSize());
+            m_script += m_decoder->flush();
+            if (statistics) {
+                ++statistics->mainThreadDecodeCount;
+                statistics->mainThreadDecodingTime += currentTime() - startTime;
+            }
+        }
         setDecodedSize(m_script.length() * sizeof(UChar));
     }
     m_decodedDataDeletionTimer.startOneShot(0);
@@ -100,6 +299,8 @@ void CachedScript::data(PassRefPtr<SharedBuffer> data, bool allDataReceived)
 
     m_data = data;
     setEncodedSize(m_data.get() ? m_data->size() : 0);
+    if (m_backgroundDecodingAllowed || (isPreloaded() && preloadResult() == PreloadNotReferenced))
+        startBackgroundDecoding();
     setLoading(false);
     checkNotify();
 }
@@ -114,6 +315,7 @@ void CachedScript::error(CachedResource::Status status)
 
 void CachedScript::destroyDecodedData()
 {
+    cancelBackgroundDecoding();
     m_script = String();
     unsigned extraSize = 0;
 #if USE(JSC)
@@ -132,6 +334,45 @@ void CachedScript::decodedDataDeletionTimerFired(Timer<CachedScript>*)
     destroyDecodedData();
 }
 
+void CachedScript::allowBackgroundDecoding()
+{
+    if (m_backgroundDecodingAllowed)
+        return;
+    m_backgroundDecodingAllowed = true;
+    if (!isLoading() && !m_decodingJob)
+        startBackgroundDecoding();
+}
+
+void CachedScript::startBackgroundDecoding()
+{
+    cancelBackgroundDecoding();
+    if (!m_data || !m_script.isNull() || encodedSize() < minimumSizeForBackgroundDecoding)
+        return;
+
+    // The job reads straight out of m_data. The extra reference keeps the buffer from being made
+    // purgeable, which would free it, until the job is done with it.
+    m_decodingData = m_data;
+    m_decodingJob = ScriptDecodingJob::create(m_decoder->encoding().name(), m_decodingData->data(), m_decodingData->size());
+    postScriptDecodingJob(m_decodingJob);
+
+    // Count the string the job will produce, so the memory cache can reclaim it by calling
+    // destroyDecodedData(). Each byte decodes to at most one UChar.
+    m_pendingDecodedSize = encodedSize() * sizeof(UChar);
+    setDecodedSize(decodedSize() + m_pendingDecodedSize);
+}
+
+void CachedScript::cancelBackgroundDecoding()
+{
+    if (!m_decodingJob)
+        return;
+    m_decodingJob->cancel();
+    m_decodingJob = 0;
+    m_decodingData = 0;
+    scriptDecodingJobDone();
+    setDecodedSize(decodedSize() - m_pendingDecodedSize);
+    m_pendingDecodedSize = 0;
+}
+
 #if USE(JSC)
 JSC::SourceProviderCache* CachedScript::sourceProviderCache() const
 {   
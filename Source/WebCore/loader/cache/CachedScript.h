@@ -38,14 +38,38 @@ namespace JSC {
 namespace WebCore {
 
     class CachedResourceLoader;
+    class ScriptDecodingJob;
     class TextResourceDecoder;
 
+    // Where the main thread's script decoding time went, totalled per page.
+    struct ScriptDecodingStatistics {
+        ScriptDecodingStatistics()
+            : mainThreadDecodeCount(0)
+            , mainThreadDecodingTime(0)
+            , backgroundDecodeCount(0)
+            , backgroundWaitTime(0)
+            , decodingTimeSaved(0)
+        {
+        }
+
+        // Scripts decoded on the main thread when they were run.
+        unsigned mainThreadDecodeCount;
+        double mainThreadDecodingTime;
+        // Scripts whose result from the helper thread was used. The main thread still spends the wait
+        // time if it has to block for the helper; only the rest of the helper's decode is saved.
+        unsigned backgroundDecodeCount;
+        double backgroundWaitTime;
+        double decodingTimeSaved;
+    };
+
     class CachedScript : public CachedResource {
     public:
         CachedScript(const ResourceRequest&, const String& charset);
         virtual ~CachedScript();
 
-        const String& script();
+        // Decodes the script if needed. The main thread time this costs, or saves, is added to the
+        // statistics if they are given.
+        const String& script(ScriptDecodingStatistics* = 0);
 
         virtual void didAddClient(CachedResourceClient*);
         virtual void allClientsRemoved();
@@ -56,6 +80,11 @@ namespace WebCore {
         virtual void error(Status);
 
         virtual void destroyDecodedData();
+
+        // Called for scripts that will not run as soon as they have loaded, such as async and deferred
+        // scripts, so that a large script can be decoded on a helper thread in the meantime.
+        void allowBackgroundDecoding();
+
 #if USE(JSC)        
         // Allows JSC to cache additional information about the source.
         JSC::SourceProviderCache* sourceProviderCache() const;
@@ -65,9 +94,16 @@ namespace WebCore {
         void decodedDataDeletionTimerFired(Timer<CachedScript>*);
         virtual PurgePriority purgePriority() const { return PurgeLast; }
 
+        void startBackgroundDecoding();
+        void cancelBackgroundDecoding();
+
         String m_script;
         RefPtr<TextResourceDecoder> m_decoder;
+        RefPtr<ScriptDecodingJob> m_decodingJob;
         Timer<CachedScript> m_decodedDataDeletionTimer;
+        RefPtr<SharedBuffer> m_decodingData;
+        unsigned m_pendingDecodedSize;
+        bool m_backgroundDecodingAllowed;
 #if USE(JSC)        
         mutable OwnPtr<JSC::SourceProviderCache> m_sourceProviderCache;
 #endif
@@ -120,7 +120,6 @@ FrameView::FrameView(Frame* frame)
     , m_slowRepaintObjectCount(0)
     , m_fixedObjectCount(0)
     , m_layoutTimer(this, &FrameView::layoutTimerFired)
-    , m_layoutRoot(0)
     , m_hasPendingPostLayoutTasks(false)
     , m_inSynchronousPostLayout(false)
     , m_postLayoutTasksTimer(this, &FrameView::postLayoutTimerFired)
@@ -213,7 +212,7 @@ void FrameView::reset()
     m_borderX = 30;
     m_borderY = 30;
     m_layoutTimer.stop();
-    m_layoutRoot = 0;
+    m_layoutRoots.clear();
     m_delayedLayout = false;
     m_doFullRepaint = true;
     m_layoutSchedulingEnabled = true;
@@ -545,7 +544,7 @@ void FrameView::calculateScrollbarModesForLayout(ScrollbarMode& hMode, Scrollbar
         vMode = ScrollbarAlwaysOff;
     }
     
-    if (!m_layoutRoot) {
+    if (m_layoutRoots.isEmpty()) {
         Document* document = m_frame->document();
         Node* documentElement = document->documentElement();
         RenderObject* rootRenderer = documentElement ? documentElement->renderer() : 0;
@@ -779,9 +778,20 @@ void FrameView::willMoveOffscreen()
     scrollAnimator()->contentAreaDidHide();
 }
 
-RenderObject* FrameView::layoutRoot(bool onlyDuringLayout) const
+bool FrameView::isLayoutRoot(RenderObject* renderer, bool onlyDuringLayout) const
 {
-    return onlyDuringLayout && layoutPending() ? 0 : m_layoutRoot;
+    if (onlyDuringLayout && layoutPending())
+        return false;
+    return m_layoutRoots.contains(renderer);
+}
+
+static bool isLayerAncestorOrSelf(RenderLayer* ancestor, RenderLayer* layer)
+{
+    for (RenderLayer* l = layer; l; l = l->parent()) {
+        if (l == ancestor)
+            return true;
+    }
+    return false;
 }
 
 void FrameView::layout(bool allowSubtree)
@@ -824,10 +834,8 @@ void FrameView::layout(bool allowSubtree)
 
     InspectorInstrumentationCookie cookie = InspectorInstrumentation::willLayout(m_frame.get());
 
-    if (!allowSubtree && m_layoutRoot) {
-        m_layoutRoot->markContainingBlocksForLayout(false);
-        m_layoutRoot = 0;
-    }
+    if (!allowSubtree)
+        clearLayoutRoots();
 
     ASSERT(m_frame->view() == this);
 
@@ -853,14 +861,14 @@ void FrameView::layout(bool allowSubtree)
     // the layout beats any sort of style recalc update that needs to occur.
     document->updateStyleIfNeeded();
     
-    bool subtree = m_layoutRoot;
+    bool subtree = !m_layoutRoots.isEmpty();
 
     // If there is only one ref to this view left, then its going to be destroyed as soon as we exit, 
     // so there's no point to continuing to layout
     if (protector->hasOneRef())
         return;
 
-    RenderObject* root = subtree ? m_layoutRoot : document->renderer();
+    RenderObject* root = subtree ? m_layoutRoots[0] : document->renderer();
     if (!root) {
         // FIXME: Do we need to set m_size here?
         m_layoutSchedulingEnabled = true;
@@ -869,7 +877,7 @@ void FrameView::layout(bool allowSubtree)
 
     m_nestedLayoutCount++;
 
-    if (!m_layoutRoot) {
+    if (!subtree) {
         Document* document = m_frame->document();
         Node* documentElement = document->documentElement();
         RenderObject* rootRenderer = documentElement ? documentElement->renderer() : 0;
@@ -946,32 +954,41 @@ void FrameView::layout(bool allowSubtree)
         }
     }
 
-    RenderLayer* layer = root->enclosingLayer();
-
     m_actionScheduler->pause();
 
-    bool disableLayoutState = false;
-    if (subtree) {
-        RenderView* view = root->view();
-        disableLayoutState = view->shouldDisableLayoutStateForSubtree(root);
-        view->pushLayoutState(root);
-        if (disableLayoutState)
-            view->disableLayoutState();
-    }
-        
+    // Layout roots are relayout boundaries whose size does not depend on their contents,
+    // so each one is laid out on its own without affecting the others.
+    Vector<RenderObject*> layoutRoots;
+    if (subtree)
+        layoutRoots = m_layoutRoots;
+    else
+        layoutRoots.append(root);
+
     m_inLayout = true;
     beginDeferredRepaints();
-    root->layout();
-    endDeferredRepaints();
-    m_inLayout = false;
+    for (size_t i = 0; i < layoutRoots.size(); ++i) {
+        RenderObject* layoutRoot = layoutRoots[i];
+        bool disableLayoutState = false;
+        if (subtree) {
+            RenderView* view = layoutRoot->view();
+            disableLayoutState = view->shouldDisableLayoutStateForSubtree(layoutRoot);
+            view->pushLayoutState(layoutRoot);
+            if (disableLayoutState)
+                view->disableLayoutState();
+        }
+
+        layoutRoot->layout();
 
-    if (subtree) {
-        RenderView* view = root->view();
-        view->popLayoutState(root);
-        if (disableLayoutState)
-            view->enableLayoutState();
+        if (subtree) {
+            RenderView* view = layoutRoot->view();
+            view->popLayoutState(layoutRoot);
+            if (disableLayoutState)
+                view->enableLayoutState();
+        }
     }
-    m_layoutRoot = 0;
+    endDeferredRepaints();
+    m_inLayout = false;
+    m_layoutRoots.clear();
 
     m_layoutSchedulingEnabled = true;
 
@@ -984,10 +1001,31 @@ void FrameView::layout(bool allowSubtree)
     if (m_doFullRepaint)
         root->view()->repaint(); // FIXME: This isn't really right, since the RenderView doesn't fully encompass the visibleContentRect(). It just happens
                                  // to work out most of the time, since first layouts and printing don't have you scrolled anywhere.
-    layer->updateLayerPositions((m_doFullRepaint ? 0 : RenderLayer::CheckForRepaint)
-                                | RenderLayer::IsCompositingUpdateRoot
-                                | RenderLayer::UpdateCompositingLayers,
-                                subtree ? 0 : &cachedOffset);
+
+    // Updating a layer updates all the layers inside it, so only the outermost of the roots' enclosing layers is
+    // updated when several roots share a layer or one root's layer contains another's.
+    Vector<RenderLayer*> layersToUpdate;
+    for (size_t i = 0; i < layoutRoots.size(); ++i) {
+        RenderLayer* layer = layoutRoots[i]->enclosingLayer();
+        bool isCovered = false;
+        for (size_t j = 0; j < layersToUpdate.size() && !isCovered; ++j)
+            isCovered = isLayerAncestorOrSelf(layersToUpdate[j], layer);
+        if (isCovered)
+            continue;
+        for (size_t j = 0; j < layersToUpdate.size(); ) {
+            if (isLayerAncestorOrSelf(layer, layersToUpdate[j]))
+                layersToUpdate.remove(j);
+            else
+                ++j;
+        }
+        layersToUpdate.append(layer);
+    }
+    for (size_t i = 0; i < layersToUpdate.size(); ++i) {
+        layersToUpdate[i]->updateLayerPositions((m_doFullRepaint ? 0 : RenderLayer::CheckForRepaint)
+                                                | RenderLayer::IsCompositingUpdateRoot
+                                                | RenderLayer::UpdateCompositingLayers,
+                                                subtree ? 0 : &cachedOffset);
+    }
     endDeferredRepaints();
 
 #if USE(ACCELERATED_COMPOSITING)
@@ -997,14 +1035,19 @@ void FrameView::layout(bool allowSubtree)
     m_layoutCount++;
 
 #if PLATFORM(MAC) || PLATFORM(CHROMIUM)
-    if (AXObjectCache::accessibilityEnabled())
-        root->document()->axObjectCache()->postNotification(root, AXObjectCache::AXLayoutComplete, true);
+    if (AXObjectCache::accessibilityEnabled()) {
+        for (size_t i = 0; i < layoutRoots.size(); ++i)
+            layoutRoots[i]->document()->axObjectCache()->postNotification(layoutRoots[i], AXObjectCache::AXLayoutComplete, true);
+    }
 #endif
 #if ENABLE(DASHBOARD_SUPPORT)
     updateDashboardRegions();
 #endif
 
-    ASSERT(!root->needsLayout());
+#ifndef NDEBUG
+    for (size_t i = 0; i < layoutRoots.size(); ++i)
+        ASSERT(!layoutRoots[i]->needsLayout());
+#endif
 
     updateCanBlitOnScrollRecursively();
 
@@ -1727,10 +1770,7 @@ void FrameView::scheduleRelayout()
     // too many false assertions.  See <rdar://problem/7218118>.
     ASSERT(m_frame->view() == this);
 
-    if (m_layoutRoot) {
-        m_layoutRoot->markContainingBlocksForLayout(false);
-        m_layoutRoot = 0;
-    }
+    clearLayoutRoots();
     if (!m_layoutSchedulingEnabled)
         return;
     if (!needsLayout())
@@ -1775,6 +1815,55 @@ static bool isObjectAncestorContainerOf(RenderObject* ancestor, RenderObject* de
     return false;
 }
 
+// Beyond this many independent roots, a full layout is likely to be cheaper than the bookkeeping.
+static const size_t maximumLayoutRoots = 8;
+
+bool FrameView::addLayoutRoot(RenderObject* relayoutRoot)
+{
+    // A pending layout without roots is a layout of the whole document.
+    if (m_layoutRoots.isEmpty())
+        return false;
+
+    for (size_t i = 0; i < m_layoutRoots.size(); ++i) {
+        RenderObject* layoutRoot = m_layoutRoots[i];
+        if (layoutRoot == relayoutRoot)
+            return true;
+        if (isObjectAncestorContainerOf(layoutRoot, relayoutRoot)) {
+            // Keep the current root
+            relayoutRoot->markContainingBlocksForLayout(false, layoutRoot);
+            ASSERT(!layoutRoot->container() || !layoutRoot->container()->needsLayout());
+            return true;
+        }
+    }
+
+    // Roots added while laying out would be dropped when layout finishes.
+    if (m_inLayout)
+        return false;
+
+    // Re-root any current roots inside relayoutRoot at relayoutRoot.
+    for (size_t i = 0; i < m_layoutRoots.size(); ) {
+        if (isObjectAncestorContainerOf(relayoutRoot, m_layoutRoots[i])) {
+            m_layoutRoots[i]->markContainingBlocksForLayout(false, relayoutRoot);
+            m_layoutRoots.remove(i);
+        } else
+            ++i;
+    }
+
+    if (m_layoutRoots.size() >= maximumLayoutRoots)
+        return false;
+    m_layoutRoots.append(relayoutRoot);
+    ASSERT(!relayoutRoot->container() || !relayoutRoot->container()->needsLayout());
+    return true;
+}
+
+void FrameView::clearLayoutRoots()
+{
+    // Mark the paths from the roots up to the RenderView, so that the next layout covers the whole document.
+    for (size_t i = 0; i < m_layoutRoots.size(); ++i)
+        m_layoutRoots[i]->markContainingBlocksForLayout(false);
+    m_layoutRoots.clear();
+}
+
 void FrameView::scheduleRelayoutOfSubtree(RenderObject* relayoutRoot)
 {
     ASSERT(m_frame->view() == this);
@@ -1786,28 +1875,18 @@ void FrameView::scheduleRelayoutOfSubtree(RenderObject* relayoutRoot)
     }
 
     if (layoutPending() || !m_layoutSchedulingEnabled) {
-        if (m_layoutRoot != relayoutRoot) {
-            if (isObjectAncestorContainerOf(m_layoutRoot, relayoutRoot)) {
-                // Keep the current root
-                relayoutRoot->markContainingBlocksForLayout(false, m_layoutRoot);
-                ASSERT(!m_layoutRoot->container() || !m_layoutRoot->container()->needsLayout());
-            } else if (m_layoutRoot && isObjectAncestorContainerOf(relayoutRoot, m_layoutRoot)) {
-                // Re-root at relayoutRoot
-                m_layoutRoot->markContainingBlocksForLayout(false, relayoutRoot);
-                m_layoutRoot = relayoutRoot;
-                ASSERT(!m_layoutRoot->container() || !m_layoutRoot->container()->needsLayout());
-            } else {
-                // Just do a full relayout
-                if (m_layoutRoot)
-                    m_layoutRoot->markContainingBlocksForLayout(false);
-                m_layoutRoot = 0;
-                relayoutRoot->markContainingBlocksForLayout(false);
-            }
+        if (!addLayoutRoot(relayoutRoot)) {
+            // Just do a full relayout
+            clearLayoutRoots();
+            relayoutRoot->markContainingBlocksForLayout(false);
         }
     } else if (m_layoutSchedulingEnabled) {
         int delay = m_frame->document()->minimumLayoutDelay();
-        m_layoutRoot = relayoutRoot;
-        ASSERT(!m_layoutRoot->container() || !m_layoutRoot->container()->needsLayout());
+        if (!addLayoutRoot(relayoutRoot)) {
+            m_layoutRoots.clear();
+            m_layoutRoots.append(relayoutRoot);
+        }
+        ASSERT(!relayoutRoot->container() || !relayoutRoot->container()->needsLayout());
         m_delayedLayout = delay != 0;
         m_layoutTimer.startOneShot(delay * 0.001);
     }
@@ -1828,7 +1907,7 @@ bool FrameView::needsLayout() const
     RenderView* root = m_frame->contentRenderer();
     return layoutPending()
         || (root && root->needsLayout())
-        || m_layoutRoot
+        || !m_layoutRoots.isEmpty()
         || (m_deferSetNeedsLayouts && m_setNeedsLayoutWasDeferred);
 }
 
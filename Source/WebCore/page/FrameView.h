@@ -92,7 +92,7 @@ public:
     bool layoutPending() const;
     bool isInLayout() const { return m_inLayout; }
 
-    RenderObject* layoutRoot(bool onlyDuringLayout = false) const;
+    bool isLayoutRoot(RenderObject*, bool onlyDuringLayout = false) const;
     int layoutCount() const { return m_layoutCount; }
 
     bool needsLayout() const;
@@ -291,6 +291,9 @@ private:
     void reset();
     void init();
 
+    bool addLayoutRoot(RenderObject*);
+    void clearLayoutRoots();
+
     virtual bool isFrameView() const;
 
     friend class RenderWidget;
@@ -375,7 +378,8 @@ private:
 
     Timer<FrameView> m_layoutTimer;
     bool m_delayedLayout;
-    RenderObject* m_layoutRoot;
+    // Relayout boundaries to lay out on their own, none containing another. Empty when the whole document needs layout.
+    Vector<RenderObject*> m_layoutRoots;
     
     bool m_layoutSchedulingEnabled;
     bool m_inLayout;
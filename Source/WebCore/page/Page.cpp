@@ -24,6 +24,7 @@
 #include "BackForwardList.h"
 #include "Base64.h"
 #include "CSSStyleSelector.h"
+#include "CachedScript.h"
 #include "Chrome.h"
 #include "ChromeClient.h"
 #include "ContextMenuClient.h"
@@ -177,6 +178,7 @@ Page::Page(const PageClients& pageClients)
     , m_canStartMedia(true)
     , m_viewMode(ViewModeWindowed)
     , m_minimumTimerInterval(Settings::defaultMinDOMTimerInterval())
+    , m_scriptDecodingStatistics(adoptPtr(new ScriptDecodingStatistics))
     , m_isEditable(false)
 {
     if (!allPages) {
@@ -74,6 +74,7 @@ namespace WebCore {
     class ProgressTracker;
     class RenderTheme;
     class VisibleSelection;
+    struct ScriptDecodingStatistics;
     class ScrollableArea;
     class SelectionController;
     class Settings;
@@ -292,6 +293,8 @@ namespace WebCore {
         bool containsScrollableArea(ScrollableArea*) const;
         const ScrollableAreaSet* scrollableAreaSet() const { return m_scrollableAreaSet.get(); }
 
+        ScriptDecodingStatistics& scriptDecodingStatistics() { return *m_scriptDecodingStatistics; }
+
         // Don't allow more than a certain number of frames in a page.
         // This seems like a reasonable upper bound, and otherwise mutually
         // recursive frameset pages can quickly bring the program to its knees
@@ -406,6 +409,8 @@ namespace WebCore {
 
         OwnPtr<ScrollableAreaSet> m_scrollableAreaSet;
 
+        OwnPtr<ScriptDecodingStatistics> m_scriptDecodingStatistics;
+
         bool m_isEditable;
     };
 
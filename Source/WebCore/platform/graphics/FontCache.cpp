@@ -364,6 +364,142 @@ size_t FontCache::inactiveFontDataCount()
     return 0;
 }
 
+struct WidthCacheKey {
+    WidthCacheKey()
+        : m_fontSelectorVersion(0)
+        , m_isDeletedValue(false)
+    {
+    }
+
+    WidthCacheKey(const FontDescription& fontDescription, unsigned fontSelectorVersion, const UChar* characters, unsigned length)
+        : m_fontDescription(fontDescription)
+        , m_fontSelectorVersion(fontSelectorVersion)
+        , m_text(characters, length)
+        , m_isDeletedValue(false)
+    {
+    }
+
+    WidthCacheKey(HashTableDeletedValueType)
+        : m_fontSelectorVersion(0)
+        , m_isDeletedValue(true)
+    {
+    }
+
+    bool isHashTableDeletedValue() const { return m_isDeletedValue; }
+
+    bool operator==(const WidthCacheKey& other) const
+    {
+        return m_isDeletedValue == other.m_isDeletedValue && m_fontSelectorVersion == other.m_fontSelectorVersion
+            && m_text == other.m_text && m_fontDescription == other.m_fontDescription;
+    }
+
+    FontDescription m_fontDescription;
+    unsigned m_fontSelectorVersion;
+    String m_text;
+    bool m_isDeletedValue;
+};
+
+static unsigned computeWidthCacheHash(const FontDescription& fontDescription, unsigned fontSelectorVersion, const UChar* characters, unsigned length)
+{
+    unsigned hashCodes[5] = {
+        StringHasher::computeHash(characters, length),
+        fontDescription.family().family().impl() ? fontDescription.family().family().impl()->existingHash() : 0,
+        static_cast<unsigned>(fontDescription.computedSize() * 64),
+        fontSelectorVersion,
+        static_cast<unsigned>(fontDescription.weight()) << 2 | static_cast<unsigned>(fontDescription.italic()) << 1 | static_cast<unsigned>(fontDescription.smallCaps())
+    };
+    return StringHasher::hashMemory<sizeof(hashCodes)>(hashCodes);
+}
+
+struct WidthCacheKeyHash {
+    static unsigned hash(const WidthCacheKey& key)
+    {
+        return computeWidthCacheHash(key.m_fontDescription, key.m_fontSelectorVersion, key.m_text.characters(), key.m_text.length());
+    }
+
+    static bool equal(const WidthCacheKey& a, const WidthCacheKey& b)
+    {
+        return a == b;
+    }
+
+    static const bool safeToCompareToEmptyOrDeleted = true;
+};
+
+struct WidthCacheKeyTraits : WTF::SimpleClassHashTraits<WidthCacheKey> {
+    // An empty key has the default font description, which is not all zeroes.
+    static const bool emptyValueIsZero = false;
+};
+
+typedef HashMap<WidthCacheKey, float, WidthCacheKeyHash, WidthCacheKeyTraits> WidthCache;
+
+// Looks up a width without copying the font description or the text.
+struct WidthCacheLookupKey {
+    const FontDescription& fontDescription;
+    unsigned fontSelectorVersion;
+    const UChar* characters;
+    unsigned length;
+};
+
+struct WidthCacheLookupTranslator {
+    static unsigned hash(const WidthCacheLookupKey& key)
+    {
+        return computeWidthCacheHash(key.fontDescription, key.fontSelectorVersion, key.characters, key.length);
+    }
+
+    static bool equal(const WidthCacheKey& a, const WidthCacheLookupKey& b)
+    {
+        return !a.m_isDeletedValue && a.m_fontSelectorVersion == b.fontSelectorVersion && a.m_text.length() == b.length
+            && !memcmp(a.m_text.characters(), b.characters, b.length * sizeof(UChar)) && a.m_fontDescription == b.fontDescription;
+    }
+
+    static void translate(WidthCacheKey& location, const WidthCacheLookupKey& key, unsigned)
+    {
+        location = WidthCacheKey(key.fontDescription, key.fontSelectorVersion, key.characters, key.length);
+    }
+};
+
+// One table for all fonts. Past this many entries it is emptied, and refills with the words
+// currently being laid out.
+static const unsigned maxWidthCacheSize = 16384;
+
+static WidthCache* gWidthCache;
+static FontCache::WidthCacheStatistics gWidthCacheStatistics;
+
+bool FontCache::cachedWidth(const FontDescription& fontDescription, unsigned fontSelectorVersion, const UChar* characters, unsigned length, float& width)
+{
+    ++gWidthCacheStatistics.lookups;
+    if (!gWidthCache)
+        return false;
+
+    WidthCacheLookupKey key = { fontDescription, fontSelectorVersion, characters, length };
+    WidthCache::iterator it = gWidthCache->find<WidthCacheLookupKey, WidthCacheLookupTranslator>(key);
+    if (it == gWidthCache->end())
+        return false;
+    ++gWidthCacheStatistics.hits;
+    width = it->second;
+    return true;
+}
+
+void FontCache::cacheWidth(const FontDescription& fontDescription, unsigned fontSelectorVersion, const UChar* characters, unsigned length, float width)
+{
+    if (!gWidthCache)
+        gWidthCache = new WidthCache;
+    else if (gWidthCache->size() >= maxWidthCacheSize) {
+        gWidthCache->clear();
+        ++gWidthCacheStatistics.clears;
+    }
+
+    WidthCacheLookupKey key = { fontDescription, fontSelectorVersion, characters, length };
+    gWidthCache->add<WidthCacheLookupKey, WidthCacheLookupTranslator>(key, width);
+}
+
+FontCache::WidthCacheStatistics FontCache::widthCacheStatistics()
+{
+    WidthCacheStatistics statistics = gWidthCacheStatistics;
+    statistics.size = gWidthCache ? gWidthCache->size() : 0;
+    return statistics;
+}
+
 const FontData* FontCache::getFontData(const Font& font, int& familyIndex, FontSelector* fontSelector)
 {
     SimpleFontData* result = 0;
@@ -452,6 +588,10 @@ void FontCache::invalidate()
 
     gGeneration++;
 
+    // Widths measured with fonts that have no font selector are only keyed on the description.
+    if (gWidthCache)
+        gWidthCache->clear();
+
     Vector<RefPtr<FontSelector> > clients;
     size_t numClients = gClients->size();
     clients.reserveInitialCapacity(numClients);
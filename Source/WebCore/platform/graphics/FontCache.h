@@ -93,6 +93,21 @@ public:
     size_t inactiveFontDataCount();
     void purgeInactiveFontData(int count = INT_MAX);
 
+    // Widths of short simple text runs, so that line breaking does not measure the same words again
+    // on every layout. The fonts are identified by their description and the version of their font
+    // selector, 0 if there is none. Only runs whose width depends on nothing else belong here; see
+    // Font::width().
+    bool cachedWidth(const FontDescription&, unsigned fontSelectorVersion, const UChar*, unsigned length, float& width);
+    void cacheWidth(const FontDescription&, unsigned fontSelectorVersion, const UChar*, unsigned length, float width);
+
+    struct WidthCacheStatistics {
+        unsigned lookups;
+        unsigned hits;
+        unsigned clears;
+        size_t size;
+    };
+    WidthCacheStatistics widthCacheStatistics();
+
 private:
     FontCache();
     ~FontCache();
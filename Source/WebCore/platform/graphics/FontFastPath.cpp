@@ -446,6 +446,50 @@ void Font::drawEmphasisMarks(GraphicsContext* context, const GlyphBuffer& glyphB
     drawGlyphBuffer(context, markBuffer, startPoint);
 }
 
+// Longer runs rarely repeat exactly, and would tie the size of the width cache to the text.
+static const int maxWidthCacheRunLength = 16;
+
+static inline bool canUseWidthCache(const Font& font, const TextRun& run)
+{
+    // A platform font is not described by its font description.
+    if (font.isPlatformFont())
+        return false;
+    if (run.length() > maxWidthCacheRunLength || run.rtl() || run.expansion())
+        return false;
+    if ((font.letterSpacing() || font.wordSpacing()) && !run.spacingDisabled())
+        return false;
+#if ENABLE(SVG)
+    if (run.horizontalGlyphStretch() != 1)
+        return false;
+#endif
+    // The width of a tab depends on where the run starts.
+    if (run.allowTabs()) {
+        for (int i = 0; i < run.length(); ++i) {
+            if (run[i] == '\t')
+                return false;
+        }
+    }
+    return true;
+}
+
+float Font::cachedFloatWidthForSimpleText(const TextRun& run) const
+{
+    if (!canUseWidthCache(*this, run))
+        return floatWidthForSimpleText(run, 0);
+
+    FontSelector* selector = fontSelector();
+    unsigned fontSelectorVersion = selector ? selector->version() : 0;
+    float width;
+    if (fontCache()->cachedWidth(m_fontDescription, fontSelectorVersion, run.characters(), run.length(), width))
+        return width;
+
+    width = floatWidthForSimpleText(run, 0);
+    // Widths measured while web fonts load come from the fallback fonts.
+    if (!loadingCustomFonts())
+        fontCache()->cacheWidth(m_fontDescription, fontSelectorVersion, run.characters(), run.length(), width);
+    return width;
+}
+
 float Font::floatWidthForSimpleText(const TextRun& run, GlyphBuffer* glyphBuffer, HashSet<const SimpleFontData*>* fallbackFonts, GlyphOverflow* glyphOverflow) const
 {
     WidthIterator it(this, run, fallbackFonts, glyphOverflow);
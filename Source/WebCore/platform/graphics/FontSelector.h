@@ -42,6 +42,10 @@ public:
 
     virtual void fontCacheInvalidated() { }
 
+    // Changes whenever the fonts this selector returns may have changed. No two selectors share a
+    // version, and 0 is never used, so the version also identifies the selector.
+    virtual unsigned version() const = 0;
+
     virtual void registerForInvalidationCallbacks(FontSelectorClient*) = 0;
     virtual void unregisterForInvalidationCallbacks(FontSelectorClient*) = 0;
 };
@@ -1480,9 +1480,15 @@ bool RenderBlock::matchedEndLine(const InlineBidiResolver& resolver, const Inlin
     }
 
     // The first clean line doesn't match, but we can check a handful of following lines to try
-    // to match back up.
-    static int numLines = 8; // The # of lines we're willing to match against.
+    // to match back up. Clean lines that break before the current position within the same text can
+    // never match, so the handful starts after them. That way a reflow running on for more than a
+    // handful of lines of one text node (an edit in the middle of a long paragraph) can still match
+    // back up. Nothing is deleted unless a match is found; the next line tries again from endLine.
     RootInlineBox* line = endLine;
+    while (line && line->nextRootBox() && line->lineBreakObj() == resolver.position().m_obj
+           && line->lineBreakPos() < resolver.position().m_pos)
+        line = line->nextRootBox();
+    static int numLines = 8; // The # of lines we're willing to match against.
     for (int i = 0; i < numLines && line; i++, line = line->nextRootBox()) {
         if (line->lineBreakObj() == resolver.position().m_obj && line->lineBreakPos() == resolver.position().m_pos) {
             // We have a match.
@@ -1558,7 +1558,7 @@ void RenderBox::computeLogicalWidth()
     }
 
     // If layout is limited to a subtree, the subtree root's logical width does not change.
-    if (node() && view()->frameView() && view()->frameView()->layoutRoot(true) == this)
+    if (node() && view()->frameView() && view()->frameView()->isLayoutRoot(this, true))
         return;
 
     // The parent box is flexing us, so it has increased or decreased our
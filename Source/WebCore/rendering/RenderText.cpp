@@ -1048,8 +1048,10 @@ void RenderText::setTextWithOffset(PassRefPtr<StringImpl> text, unsigned offset,
 
     bool dirtiedLines = false;
 
-    // Dirty all text boxes that include characters in between offset and offset+len.
-    for (InlineTextBox* curr = firstTextBox(); curr; curr = curr->nextTextBox()) {
+    // Dirty all text boxes that include characters in between offset and offset+len. Appended text
+    // comes after every existing box, so there is nothing to find.
+    InlineTextBox* firstAffectedBox = offset < oldLen ? firstTextBox() : 0;
+    for (InlineTextBox* curr = firstAffectedBox; curr; curr = curr->nextTextBox()) {
         // Text run is entirely before the affected range.
         if (curr->end() < offset)
             continue;
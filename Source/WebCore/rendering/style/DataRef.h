@@ -48,6 +48,12 @@ public:
         m_data = T::create();
     }
 
+    // Switches to an equal instance already in the table, or adds this one, so equal data is only allocated once.
+    template <typename Table> void intern(Table& table)
+    {
+        m_data = *table.add(m_data).first;
+    }
+
     bool operator==(const DataRef<T>& o) const
     {
         ASSERT(m_data);
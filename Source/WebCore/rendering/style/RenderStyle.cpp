@@ -33,7 +33,9 @@
 #include "ScaleTransformOperation.h"
 #include "ShadowData.h"
 #include "StyleImage.h"
+#include <wtf/HashSet.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/StringHasher.h>
 #include <algorithm>
 
 using namespace std;
@@ -169,6 +171,33 @@ void RenderStyle::inheritFrom(const RenderStyle* inheritParent)
 #endif
 }
 
+void RenderStyle::copyNonInheritedFrom(const RenderStyle* other)
+{
+    m_box = other->m_box;
+    visual = other->visual;
+    m_background = other->m_background;
+    surround = other->surround;
+    rareNonInheritedData = other->rareNonInheritedData;
+    // The flags are copied one by one since noninherited_flags also holds state that is not style data.
+    noninherited_flags._effectiveDisplay = other->noninherited_flags._effectiveDisplay;
+    noninherited_flags._originalDisplay = other->noninherited_flags._originalDisplay;
+    noninherited_flags._overflowX = other->noninherited_flags._overflowX;
+    noninherited_flags._overflowY = other->noninherited_flags._overflowY;
+    noninherited_flags._vertical_align = other->noninherited_flags._vertical_align;
+    noninherited_flags._clear = other->noninherited_flags._clear;
+    noninherited_flags._position = other->noninherited_flags._position;
+    noninherited_flags._floating = other->noninherited_flags._floating;
+    noninherited_flags._table_layout = other->noninherited_flags._table_layout;
+    noninherited_flags._page_break_before = other->noninherited_flags._page_break_before;
+    noninherited_flags._page_break_after = other->noninherited_flags._page_break_after;
+    noninherited_flags._page_break_inside = other->noninherited_flags._page_break_inside;
+    noninherited_flags._unicodeBidi = other->noninherited_flags._unicodeBidi;
+#if ENABLE(SVG)
+    if (m_svgStyle != other->m_svgStyle)
+        m_svgStyle.access()->copyNonInheritedFrom(other->m_svgStyle.get());
+#endif
+}
+
 RenderStyle::~RenderStyle()
 {
 }
@@ -280,6 +309,108 @@ bool RenderStyle::inheritedNotEqual(const RenderStyle* other) const
            || rareInheritedData != other->rareInheritedData;
 }
 
+bool RenderStyle::inheritedDataShared(const RenderStyle* other) const
+{
+    // Only checks whether the inherited data is physically shared, so it is cheap but may report false negatives.
+    return inherited_flags == other->inherited_flags
+        && inherited.get() == other->inherited.get()
+#if ENABLE(SVG)
+        && m_svgStyle.get() == other->m_svgStyle.get()
+#endif
+        && rareInheritedData.get() == other->rareInheritedData.get();
+}
+
+static inline unsigned lengthHash(const Length& length)
+{
+    return (static_cast<unsigned>(length.value()) << 5) ^ (length.type() << 1) ^ length.quirk();
+}
+
+static inline unsigned lengthBoxHash(const LengthBox& box)
+{
+    unsigned components[] = { lengthHash(box.left()), lengthHash(box.right()), lengthHash(box.top()), lengthHash(box.bottom()) };
+    return StringHasher::hashMemory<sizeof(components)>(components);
+}
+
+static inline unsigned borderValueHash(const BorderValue& border)
+{
+    return (border.color().rgb() << 8) ^ (border.width() << 4) ^ border.style();
+}
+
+static unsigned styleDataHash(const StyleBoxData& box)
+{
+    unsigned components[] = {
+        lengthHash(box.width()), lengthHash(box.height()),
+        lengthHash(box.minWidth()), lengthHash(box.maxWidth()),
+        lengthHash(box.minHeight()), lengthHash(box.maxHeight()),
+        lengthHash(box.verticalAlign()),
+        static_cast<unsigned>(box.zIndex()), static_cast<unsigned>((box.hasAutoZIndex() << 1) | box.boxSizing())
+    };
+    return StringHasher::hashMemory<sizeof(components)>(components);
+}
+
+static unsigned styleDataHash(const StyleSurroundData& surround)
+{
+    // Border images and radii are left to operator==; they rarely tell otherwise equal data apart.
+    const BorderData& border = surround.border;
+    unsigned components[] = {
+        lengthBoxHash(surround.offset), lengthBoxHash(surround.margin), lengthBoxHash(surround.padding),
+        borderValueHash(border.left()), borderValueHash(border.right()), borderValueHash(border.top()), borderValueHash(border.bottom())
+    };
+    return StringHasher::hashMemory<sizeof(components)>(components);
+}
+
+template <typename T> struct SharedStyleDataHash {
+    static unsigned hash(const RefPtr<T>& data) { return styleDataHash(*data); }
+    static bool equal(const RefPtr<T>& a, const RefPtr<T>& b) { return a == b || *a == *b; }
+    static const bool safeToCompareToEmptyOrDeleted = false;
+};
+
+static const unsigned minimumSharedStyleDataPruneThreshold = 256;
+
+template <typename T> class SharedStyleDataTable {
+    WTF_MAKE_NONCOPYABLE(SharedStyleDataTable);
+public:
+    SharedStyleDataTable()
+        : m_pruneThreshold(minimumSharedStyleDataPruneThreshold)
+    {
+    }
+
+    void share(DataRef<T>& data)
+    {
+        data.intern(m_table);
+        if (m_table.size() >= m_pruneThreshold)
+            prune();
+    }
+
+private:
+    typedef HashSet<RefPtr<T>, SharedStyleDataHash<T> > Table;
+
+    void prune()
+    {
+        // Entries that only the table refers to are no longer used by any style.
+        Vector<RefPtr<T> > unused;
+        typename Table::iterator end = m_table.end();
+        for (typename Table::iterator it = m_table.begin(); it != end; ++it) {
+            if ((*it)->hasOneRef())
+                unused.append(*it);
+        }
+        for (size_t i = 0; i < unused.size(); ++i)
+            m_table.remove(unused[i]);
+        m_pruneThreshold = max(minimumSharedStyleDataPruneThreshold, 2 * m_table.size());
+    }
+
+    Table m_table;
+    unsigned m_pruneThreshold;
+};
+
+void RenderStyle::shareDataWithEqualStyles()
+{
+    DEFINE_STATIC_LOCAL(SharedStyleDataTable<StyleBoxData>, boxDataTable, ());
+    DEFINE_STATIC_LOCAL(SharedStyleDataTable<StyleSurroundData>, surroundDataTable, ());
+    boxDataTable.share(m_box);
+    surroundDataTable.share(surround);
+}
+
 static bool positionedObjectMoved(const LengthBox& a, const LengthBox& b)
 {
     // If any unit types are different, then we can't guarantee
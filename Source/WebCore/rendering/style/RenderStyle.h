@@ -258,7 +258,10 @@ protected:
         unsigned _pseudoBits : 7;
         unsigned _unicodeBidi : 2; // EUnicodeBidi
         bool _isLink : 1;
-        // 50 bits
+        // Set on a parent style when a child explicitly inherits a non-inherited property from it.
+        // Not part of operator== since it describes the children rather than this style.
+        bool _explicitInheritance : 1;
+        // 51 bits
     } noninherited_flags;
 
 // !END SYNC!
@@ -303,6 +306,7 @@ protected:
         noninherited_flags._pseudoBits = 0;
         noninherited_flags._unicodeBidi = initialUnicodeBidi();
         noninherited_flags._isLink = false;
+        noninherited_flags._explicitInheritance = false;
     }
 
 private:
@@ -320,6 +324,9 @@ public:
     ~RenderStyle();
 
     void inheritFrom(const RenderStyle* inheritParent);
+    void copyNonInheritedFrom(const RenderStyle*);
+    // Replaces the box and surround data with equal instances used by other styles, when there are any.
+    void shareDataWithEqualStyles();
 
     PseudoId styleType() const { return static_cast<PseudoId>(noninherited_flags._styleType); }
     void setStyleType(PseudoId styleType) { noninherited_flags._styleType = styleType; }
@@ -1164,6 +1171,7 @@ public:
     const AtomicString& hyphenString() const;
 
     bool inheritedNotEqual(const RenderStyle*) const;
+    bool inheritedDataShared(const RenderStyle*) const;
 
     StyleDifference diff(const RenderStyle*, unsigned& changedContextSensitiveProperties) const;
 
@@ -1192,6 +1200,9 @@ public:
     bool unique() const { return m_unique; }
     void setUnique() { m_unique = true; }
 
+    bool hasExplicitlyInheritedProperties() const { return noninherited_flags._explicitInheritance; }
+    void setHasExplicitlyInheritedProperties() { noninherited_flags._explicitInheritance = true; }
+
     // Methods for indicating the style is affected by dynamic updates (e.g., children changing, our position changing in our sibling list, etc.)
     bool affectedByEmpty() const { return m_affectedByEmpty; }
     bool emptyState() const { return m_emptyState; }
@@ -27,10 +27,14 @@
 #include "config.h"
 
 #include "AndroidLog.h"
+#include "CSSStyleSelector.h"
+#include "CachedScript.h"
 #include "Command.h"
 #include "Connection.h"
 #include "DebugServer.h"
+#include "FontCache.h"
 #include "Frame.h"
+#include "Page.h"
 #include "RenderTreeAsText.h"
 #include "RenderView.h"
 #include "WebViewCore.h"
@@ -73,6 +77,43 @@ static bool callDumpDomTree(const Frame* frame, const Connection* conn) {
     return true;
 }
 
+static bool callDumpStatistics(const Frame* frame, const Connection* conn) {
+    Page* page = frame->page();
+    if (!page)
+        return false;
+
+    char buf[512];
+    const ScriptDecodingStatistics& scripts = page->scriptDecodingStatistics();
+    snprintf(buf, sizeof(buf),
+            "Script decoding: %u on the main thread in %.2f ms, "
+            "%u on the helper thread with %.2f ms waited for and %.2f ms saved\n",
+            scripts.mainThreadDecodeCount, scripts.mainThreadDecodingTime * 1000,
+            scripts.backgroundDecodeCount, scripts.backgroundWaitTime * 1000,
+            scripts.decodingTimeSaved * 1000);
+    conn->write(buf);
+
+    FontCache::WidthCacheStatistics widths = fontCache()->widthCacheStatistics();
+    snprintf(buf, sizeof(buf),
+            "Text width cache: %u lookups, %u hits (%.1f%%), %u clears, %zu entries\n",
+            widths.lookups, widths.hits,
+            widths.lookups ? 100.0 * widths.hits / widths.lookups : 0.0,
+            widths.clears, widths.size);
+    conn->write(buf);
+
+    CSSStyleSelector::MatchedDeclarationCacheStatistics styles = CSSStyleSelector::matchedDeclarationCacheStatistics();
+    unsigned styleHits = styles.sharedHits + styles.inheritedHits;
+    snprintf(buf, sizeof(buf),
+            "Matched declaration cache: %u lookups, %u hits (%.1f%%), "
+            "%u sharing inherited data, %u reapplying inherited properties, "
+            "%u reapplying everything, %u additions\n",
+            styles.lookups, styleHits,
+            styles.lookups ? 100.0 * styleHits / styles.lookups : 0.0,
+            styles.sharedHits, styles.inheritedHits - styles.fontMismatches,
+            styles.fontMismatches, styles.additions);
+    conn->write(buf);
+    return true;
+}
+
 class WebCoreHandler : public Handler {
 public:
     virtual void post(TargetThreadFunction func, void* v) const {
@@ -128,6 +169,8 @@ void Command::Init() {
                 callDumpDomTree, s_webcoreHandler));
     s_commands->append(new Command("DDRT", "Dump Render Tree",
                 callDumpRenderTree, s_webcoreHandler));
+    s_commands->append(new Command("DSTA", "Dump Statistics",
+                callDumpStatistics, s_webcoreHandler));
 }
 
 Command* Command::Find(const Connection* conn) {
@@ -423,6 +423,15 @@ unsigned int DumpRenderTreeSupportGtk::numberOfActiveAnimations(WebKitWebFrame*
     return coreFrame->animation()->numberOfActiveAnimations();
 }
 
+unsigned int DumpRenderTreeSupportGtk::elementStyleRecalcCount(WebKitWebFrame* frame)
+{
+    Frame* coreFrame = core(frame);
+    if (!coreFrame || !coreFrame->document())
+        return 0;
+
+    return coreFrame->document()->elementStyleRecalcCount();
+}
+
 void DumpRenderTreeSupportGtk::suspendAnimations(WebKitWebFrame* frame)
 {
     Frame* coreFrame = core(frame);
@@ -79,6 +79,7 @@ public:
     static bool pauseSVGAnimation(WebKitWebFrame*, const char* animationId, double time, const char* elementId);
     static WTF::CString markerTextForListItem(WebKitWebFrame*, JSContextRef, JSValueRef nodeObject);
     static unsigned int numberOfActiveAnimations(WebKitWebFrame*);
+    static unsigned int elementStyleRecalcCount(WebKitWebFrame*);
     static void suspendAnimations(WebKitWebFrame*);
     static void resumeAnimations(WebKitWebFrame*);
     static void clearMainFrameName(WebKitWebFrame*);
@@ -209,6 +209,8 @@ using namespace WebCore;
                 [NSNumber numberWithInt:heapFree], @"JavaScriptFreeSize",
                 [NSNumber numberWithUnsignedInt:(unsigned int)globalMemoryStats.stackBytes], @"JavaScriptStackSize",
                 [NSNumber numberWithUnsignedInt:(unsigned int)globalMemoryStats.JITBytes], @"JavaScriptJITSize",
+                [NSNumber numberWithUnsignedInt:(unsigned int)globalMemoryStats.JITPeakBytes], @"JavaScriptJITPeakSize",
+                [NSNumber numberWithUnsignedInt:(unsigned int)globalMemoryStats.JITAllocationFailures], @"JavaScriptJITAllocationFailures",
             nil];
 }
 
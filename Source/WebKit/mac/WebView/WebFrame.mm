@@ -1043,6 +1043,15 @@ static inline WebDataSource *dataSource(DocumentLoader* loader)
     return controller->numberOfActiveAnimations();
 }
 
+- (unsigned)_elementStyleRecalcCount
+{
+    Frame* frame = core(self);
+    if (!frame || !frame->document())
+        return 0;
+
+    return frame->document()->elementStyleRecalcCount();
+}
+
 - (void) _suspendAnimations
 {
     Frame* frame = core(self);
@@ -111,6 +111,10 @@ typedef enum {
 // Returns the total number of currently running animations (includes both CSS transitions and CSS animations).
 - (unsigned)_numberOfActiveAnimations;
 
+// Returns the number of times the style of an element in this frame's document has been recalculated.
+// This method is only intended to be used for testing style invalidation.
+- (unsigned)_elementStyleRecalcCount;
+
 // Suspend and resume animations (includes both CSS transitions and CSS animations).
 - (void)_suspendAnimations;
 - (void)_resumeAnimations;
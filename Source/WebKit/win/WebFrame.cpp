@@ -1041,6 +1041,21 @@ HRESULT STDMETHODCALLTYPE WebFrame::clearOpener()
     return hr;
 }
 
+HRESULT STDMETHODCALLTYPE WebFrame::elementStyleRecalcCount(UINT* count)
+{
+    if (!count)
+        return E_POINTER;
+
+    *count = 0;
+
+    Frame* coreFrame = core(this);
+    if (!coreFrame || !coreFrame->document())
+        return E_FAIL;
+
+    *count = coreFrame->document()->elementStyleRecalcCount();
+    return S_OK;
+}
+
 // IWebDocumentText -----------------------------------------------------------
 
 HRESULT STDMETHODCALLTYPE WebFrame::supportsTextEncoding( 
@@ -281,6 +281,8 @@ public:
 
     virtual HRESULT STDMETHODCALLTYPE clearOpener();
 
+    virtual HRESULT STDMETHODCALLTYPE elementStyleRecalcCount(UINT*);
+
     // IWebDocumentText
     virtual HRESULT STDMETHODCALLTYPE supportsTextEncoding( 
         /* [retval][out] */ BOOL* result);
@@ -274,6 +274,7 @@ public:
     bool pauseTransitionAtTimeOnElementWithId(JSStringRef propertyName, double time, JSStringRef elementId);
     bool sampleSVGAnimationForElementAtTime(JSStringRef animationId, double time, JSStringRef elementId);
     unsigned numberOfActiveAnimations() const;
+    unsigned elementStyleRecalcCount() const;
     void suspendAnimations() const;
     void resumeAnimations() const;
 
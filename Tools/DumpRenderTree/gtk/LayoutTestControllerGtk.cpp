@@ -744,6 +744,11 @@ unsigned LayoutTestController::numberOfActiveAnimations() const
     return DumpRenderTreeSupportGtk::numberOfActiveAnimations(mainFrame);
 }
 
+unsigned LayoutTestController::elementStyleRecalcCount() const
+{
+    return DumpRenderTreeSupportGtk::elementStyleRecalcCount(mainFrame);
+}
+
 void LayoutTestController::suspendAnimations() const
 {
     DumpRenderTreeSupportGtk::suspendAnimations(mainFrame);
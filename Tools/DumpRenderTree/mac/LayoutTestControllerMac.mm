@@ -766,6 +766,11 @@ unsigned LayoutTestController::numberOfActiveAnimations() const
     return [mainFrame _numberOfActiveAnimations];
 }
 
+unsigned LayoutTestController::elementStyleRecalcCount() const
+{
+    return [mainFrame _elementStyleRecalcCount];
+}
+
 void LayoutTestController::suspendAnimations() const
 {
     return [mainFrame _suspendAnimations];
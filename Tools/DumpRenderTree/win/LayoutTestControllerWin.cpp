@@ -1118,6 +1118,19 @@ unsigned LayoutTestController::numberOfActiveAnimations() const
     return number;
 }
 
+unsigned LayoutTestController::elementStyleRecalcCount() const
+{
+    COMPtr<IWebFramePrivate> framePrivate(Query, frame);
+    if (!framePrivate)
+        return 0;
+
+    UINT count = 0;
+    if (FAILED(framePrivate->elementStyleRecalcCount(&count)))
+        return 0;
+
+    return count;
+}
+
 void LayoutTestController::suspendAnimations() const
 {
     COMPtr<IWebFramePrivate> framePrivate(Query, frame);
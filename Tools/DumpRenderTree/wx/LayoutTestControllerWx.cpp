@@ -290,6 +290,12 @@ unsigned LayoutTestController::numberOfActiveAnimations() const
     return 0;
 }
 
+unsigned LayoutTestController::elementStyleRecalcCount() const
+{
+    // FIXME: implement
+    return 0;
+}
+
 void LayoutTestController::suspendAnimations() const
 {
     // FIXME: implement